@@ -1641,6 +1641,17 @@ declare global {
     interface NetworkStats {
         bytesReceived: number[];
         bytesSent: number[];
+
+        /**
+         * The number of bytes copied into the send buffers of the connections.
+         */
+        bytesCopied: number;
+
+        /**
+         * The number of calls made to send data on the sockets of the connections. Queued packets are
+         * packed together so that a flush normally takes a single call.
+         */
+        sendCalls: number;
     }
 
     type PermissionType =
@@ -2757,9 +2768,57 @@ declare global {
     interface Profiler {
         getData(): ProfiledFunction[];
         start(): void;
+        /**
+         * Stops the profiler and any trace being recorded.
+         */
         stop(): void;
         reset(): void;
+        /**
+         * Starts the profiler and records a timeline event for every profiled call,
+         * discarding any previously recorded trace.
+         */
+        startTrace(): void;
+        /**
+         * Gets the recorded trace in the Chrome trace event format, which chrome://tracing
+         * and Perfetto can open.
+         */
+        getTrace(): string;
+        /**
+         * Gets how long each part of the recent game ticks took, along with the entity
+         * and tile element counts. These are recorded even when the profiler is stopped.
+         */
+        getTickStats(): TickStats;
+        resetTickStats(): void;
         readonly enabled: boolean;
+        readonly tracing: boolean;
+    }
+
+    interface TickStats {
+        readonly tick: number;
+        /**
+         * The number of most recent ticks the times are taken over.
+         */
+        readonly tickCount: number;
+        /**
+         * One entry for each part of the game logic, followed by "Total" for the whole tick.
+         */
+        readonly parts: TickPartStats[];
+        /**
+         * The number of entities of each type, keyed like Entity.type.
+         */
+        readonly entities: { [type: string]: number };
+        readonly tileElements: number;
+    }
+
+    interface TickPartStats {
+        readonly name: string;
+        /**
+         * Times in milliseconds. The percentiles are rounded up by at most 12.5%.
+         */
+        readonly p50: number;
+        readonly p95: number;
+        readonly p99: number;
+        readonly max: number;
     }
 
     interface ProfiledFunction {
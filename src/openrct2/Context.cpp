@@ -283,14 +283,38 @@ namespace OpenRCT2
 
         int32_t RunOpenRCT2(int argc, const char** argv) override
         {
+            if (!gProfileTracePath.empty())
+            {
+                Profiling::SetThreadName("Main");
+                Profiling::Enable();
+                Profiling::StartTrace();
+            }
+
             if (Initialise())
             {
                 Launch();
+                ExportProfileTrace();
                 return EXIT_SUCCESS;
             }
             return EXIT_FAILURE;
         }
 
+        void ExportProfileTrace()
+        {
+            if (gProfileTracePath.empty())
+                return;
+
+            Profiling::StopTrace();
+            if (Profiling::ExportTrace(gProfileTracePath))
+            {
+                Console::WriteLine("Wrote profiler trace to %s", gProfileTracePath.c_str());
+            }
+            else
+            {
+                Console::Error::WriteLine("Unable to write profiler trace to %s", gProfileTracePath.c_str());
+            }
+        }
+
         void WriteLine(const std::string& s) override
         {
             _stdInOutConsole.WriteLine(s);
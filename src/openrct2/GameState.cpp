@@ -29,6 +29,7 @@
 #include "network/network.h"
 #include "platform/Platform.h"
 #include "profiling/Profiling.h"
+#include "profiling/TickStats.h"
 #include "ride/Vehicle.h"
 #include "scenario/Scenario.h"
 #include "scripting/ScriptEngine.h"
@@ -255,11 +256,16 @@ void GameState::UpdateLogic(LogicTimings* timings)
     PROFILED_FUNCTION();
 
     auto start_time = std::chrono::high_resolution_clock::now();
+    auto part_start_time = start_time;
+    TickStats::TickTimes partTimes{};
 
-    auto report_time = [timings, start_time](LogicTimePart part) {
+    auto report_time = [timings, start_time, &part_start_time, &partTimes](LogicTimePart part) {
+        auto now = std::chrono::high_resolution_clock::now();
+        partTimes[EnumValue(part)] = now - part_start_time;
+        part_start_time = now;
         if (timings != nullptr)
         {
-            timings->TimingInfo[part][timings->CurrentIdx] = std::chrono::high_resolution_clock::now() - start_time;
+            timings->TimingInfo[part][timings->CurrentIdx] = now - start_time;
         }
     };
 
@@ -391,6 +397,8 @@ void GameState::UpdateLogic(LogicTimings* timings)
     report_time(LogicTimePart::Scripts);
 #endif
 
+    TickStats::RecordTick(partTimes, part_start_time - start_time);
+
     if (timings != nullptr)
     {
         timings->CurrentIdx = (timings->CurrentIdx + 1) % LOGIC_UPDATE_MEASUREMENTS_COUNT;
@@ -46,6 +46,7 @@ namespace OpenRCT2
         GameActions,
         NetworkFlush,
         Scripts,
+        Count,
     };
 
     // ~6.5s at 40Hz
@@ -16,6 +16,9 @@ u8string gCustomOpenRCT2DataPath = {};
 u8string gCustomRCT1DataPath = {};
 u8string gCustomRCT2DataPath = {};
 u8string gCustomPassword = {};
+u8string gCustomCompression = {};
+std::optional<int32_t> gCustomCompressionLevel;
+u8string gProfileTracePath = {};
 u8string gSilentRecordingName = {};
 
 bool gOpenRCT2Headless = false;
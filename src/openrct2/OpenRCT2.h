@@ -12,6 +12,7 @@
 #include "common.h"
 #include "core/String.hpp"
 
+#include <optional>
 #include <string>
 
 enum class PromptMode : uint8_t;
@@ -44,6 +45,9 @@ extern u8string gCustomOpenRCT2DataPath;
 extern u8string gCustomRCT1DataPath;
 extern u8string gCustomRCT2DataPath;
 extern u8string gCustomPassword;
+extern u8string gCustomCompression;
+extern std::optional<int32_t> gCustomCompressionLevel;
+extern u8string gProfileTracePath;
 extern bool gOpenRCT2Headless;
 extern bool gOpenRCT2NoGraphics;
 extern bool gOpenRCT2ShowChangelog;
@@ -23,6 +23,7 @@
 #include "actions/TileModifyAction.h"
 #include "actions/TrackPlaceAction.h"
 #include "config/Config.h"
+#include "core/Compression.h"
 #include "core/DataSerialiser.h"
 #include "core/Path.hpp"
 #include "entity/EntityRegistry.h"
@@ -298,17 +299,25 @@ namespace OpenRCT2
 
             const auto& stream = recSerialiser.GetStream();
             unsigned long streamLength = static_cast<unsigned long>(stream.GetLength());
-            unsigned long compressLength = compressBound(streamLength);
 
-            MemoryStream data(compressLength);
+            ReplayRecordFile file{ _currentRecording->magic, _currentRecording->version, streamLength, MemoryStream{} };
 
-            ReplayRecordFile file{ _currentRecording->magic, _currentRecording->version, streamLength, data };
-
-            auto compressBuf = std::make_unique<unsigned char[]>(compressLength);
-            compress2(
-                compressBuf.get(), &compressLength, static_cast<const unsigned char*>(stream.GetData()), stream.GetLength(),
-                ReplayCompressionLevel);
-            file.data.Write(compressBuf.get(), compressLength);
+            // zstd data is told apart from zlib data by its frame magic when reading.
+            if (GetSaveCompression() == CompressionType::Zstd && Compression::IsSupported(CompressionType::Zstd))
+            {
+                auto compressed = Compression::Compress(
+                    CompressionType::Zstd, stream.GetData(), stream.GetLength(), GetSaveCompressionLevel());
+                file.data.Write(compressed.data(), compressed.size());
+            }
+            else
+            {
+                unsigned long compressLength = compressBound(streamLength);
+                auto compressBuf = std::make_unique<unsigned char[]>(compressLength);
+                compress2(
+                    compressBuf.get(), &compressLength, static_cast<const unsigned char*>(stream.GetData()),
+                    stream.GetLength(), ReplayCompressionLevel);
+                file.data.Write(compressBuf.get(), compressLength);
+            }
 
             DataSerialiser fileSerialiser(true);
             fileSerialiser << file.magic;
@@ -582,6 +591,24 @@ namespace OpenRCT2
                 fileSerializer << recFile.uncompressedSize;
                 fileSerializer << recFile.data;
 
+                if (Compression::IsZstdFrame(recFile.data.GetData(), recFile.data.GetLength()))
+                {
+                    if (!Compression::IsSupported(CompressionType::Zstd))
+                    {
+                        log_error("Replay is compressed with zstd which is not supported by this build");
+                        return false;
+                    }
+                    auto uncompressed = Compression::Decompress(
+                        CompressionType::Zstd, recFile.data.GetData(), recFile.data.GetLength());
+                    if (uncompressed.size() != recFile.uncompressedSize)
+                    {
+                        return false;
+                    }
+                    stream.SetPosition(0);
+                    stream.Write(uncompressed.data(), uncompressed.size());
+                    return true;
+                }
+
                 auto buff = std::make_unique<unsigned char[]>(recFile.uncompressedSize);
                 unsigned long outSize = recFile.uncompressedSize;
                 uncompress(
@@ -224,6 +224,11 @@ GameActions::Result FootpathPlaceAction::ElementUpdateExecute(PathElement* pathE
     {
         footpath_remove_edges_at(_loc, reinterpret_cast<TileElement*>(pathElement));
     }
+    else
+    {
+        // The edges are kept, but turning the path into a queue or back still changes the wide flags around it.
+        map_invalidate_path_wide_flags(_loc, 1);
+    }
 
     if (_constructFlags & PathConstructFlag::IsLegacyPathObject)
     {
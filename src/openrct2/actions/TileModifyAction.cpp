@@ -9,6 +9,7 @@
 
 #include "TileModifyAction.h"
 
+#include "../world/Map.h"
 #include "../world/TileInspector.h"
 
 using namespace OpenRCT2;
@@ -42,7 +43,13 @@ GameActions::Result TileModifyAction::Query() const
 
 GameActions::Result TileModifyAction::Execute() const
 {
-    return QueryExecute(true);
+    auto res = QueryExecute(true);
+    if (res.Error == GameActions::Status::Ok)
+    {
+        map_invalidate_path_wide_flags(_loc, 1);
+        MapInvalidateTileElementPointers();
+    }
+    return res;
 }
 
 GameActions::Result TileModifyAction::QueryExecute(bool isExecuting) const
@@ -0,0 +1,271 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2022 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "CommandLine.hpp"
+
+#ifdef USE_BENCHMARK
+
+#    include "../Context.h"
+#    include "../OpenRCT2.h"
+#    include "../core/File.h"
+#    include "../core/Imaging.h"
+#    include "../core/Path.hpp"
+#    include "../core/String.hpp"
+#    include "../drawing/Drawing.h"
+#    include "../drawing/ImageImporter.h"
+#    include "../object/ObjectList.h"
+#    include "../object/ObjectManager.h"
+#    include "../platform/Platform.h"
+
+#    include <benchmark/benchmark.h>
+#    include <cinttypes>
+#    include <cstdint>
+#    include <cstdio>
+#    include <string>
+#    include <vector>
+
+#    ifdef __linux__
+#        include <unistd.h>
+#    endif
+
+using namespace OpenRCT2;
+using namespace OpenRCT2::Drawing;
+
+// Returns the resident set size of the process in bytes, or 0 where it cannot be queried.
+static uint64_t GetResidentSetSize()
+{
+#    ifdef __linux__
+    uint64_t size = 0;
+    uint64_t resident = 0;
+    auto file = std::fopen("/proc/self/statm", "r");
+    if (file != nullptr)
+    {
+        if (std::fscanf(file, "%" SCNu64 " %" SCNu64, &size, &resident) != 2)
+        {
+            resident = 0;
+        }
+        std::fclose(file);
+    }
+    return resident * static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+#    else
+    return 0;
+#    endif
+}
+
+static void UnloadGraphics()
+{
+    gfx_unload_csg();
+    gfx_unload_g2();
+    gfx_unload_g1();
+}
+
+static void BM_load_graphics(benchmark::State& state, bool useMemoryMapping)
+{
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        state.SkipWithError("Context initialization failed.");
+        return;
+    }
+
+    auto env = context->GetPlatformEnvironment();
+    gGxUseMemoryMapping = useMemoryMapping;
+    int64_t residentGrowth = 0;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        UnloadGraphics();
+        auto residentBefore = GetResidentSetSize();
+        state.ResumeTiming();
+
+        if (!gfx_load_g1(*env))
+        {
+            state.SkipWithError("Failed to load g1.dat!");
+            break;
+        }
+        gfx_load_g2();
+        gfx_load_csg();
+
+        state.PauseTiming();
+        residentGrowth = static_cast<int64_t>(GetResidentSetSize() - residentBefore);
+        state.ResumeTiming();
+    }
+    gGxUseMemoryMapping = true;
+    state.SetItemsProcessed(state.iterations());
+    state.counters["RSS_KiB"] = static_cast<double>(residentGrowth) / 1024;
+}
+
+// Imports a sprite sheet as sprites of at most 256x256 pixels, the largest the importer accepts.
+static void BM_import_sheet(benchmark::State& state, const std::string& path, ImageImporter::ImportMode mode)
+{
+    Image image;
+    try
+    {
+        image = Imaging::ReadFromFile(path, IMAGE_FORMAT::PNG_32);
+    }
+    catch (const std::exception& e)
+    {
+        state.SkipWithError(e.what());
+        return;
+    }
+
+    ImageImporter importer;
+    size_t sprites = 0;
+    for (auto _ : state)
+    {
+        for (uint32_t y = 0; y < image.Height; y += 256)
+        {
+            for (uint32_t x = 0; x < image.Width; x += 256)
+            {
+                auto width = static_cast<int32_t>(std::min(image.Width - x, 256u));
+                auto height = static_cast<int32_t>(std::min(image.Height - y, 256u));
+                auto result = importer.Import(
+                    image, x, y, width, height, 0, 0, ImageImporter::Palette::OpenRCT2, ImageImporter::ImportFlags::RLE,
+                    mode);
+                benchmark::DoNotOptimize(result.Buffer.data());
+                sprites++;
+            }
+        }
+    }
+    state.SetItemsProcessed(sprites);
+    state.counters["Pixels"] = static_cast<double>(image.Width) * image.Height;
+}
+
+static void RegisterImportBenchmarks(const std::string& path)
+{
+    using ImportMode = ImageImporter::ImportMode;
+    benchmark::RegisterBenchmark(("import " + path + " [default]").c_str(), BM_import_sheet, path, ImportMode::Default);
+    benchmark::RegisterBenchmark(("import " + path + " [closest]").c_str(), BM_import_sheet, path, ImportMode::Closest);
+    benchmark::RegisterBenchmark(("import " + path + " [dithering]").c_str(), BM_import_sheet, path, ImportMode::Dithering);
+}
+
+// Reloads every object the park uses, which is dominated by decoding and importing the images of custom objects.
+static void BM_load_objects(benchmark::State& state, const std::string& path)
+{
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        state.SkipWithError("Context initialization failed.");
+        return;
+    }
+    if (!context->LoadParkFromFile(path))
+    {
+        state.SkipWithError("Failed to load file!");
+        return;
+    }
+
+    auto& objectManager = context->GetObjectManager();
+    auto objectList = objectManager.GetLoadedObjects();
+    size_t numObjects = 0;
+    for ([[maybe_unused]] const auto& entry : objectList)
+    {
+        numObjects++;
+    }
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        objectManager.UnloadAll();
+        state.ResumeTiming();
+
+        objectManager.LoadObjects(objectList);
+    }
+    state.SetItemsProcessed(state.iterations() * numObjects);
+    state.counters["Objects"] = static_cast<double>(numObjects);
+}
+
+static int CmdlineForBenchGraphics(int argc, const char* const* argv)
+{
+    // Google benchmark does stuff to argv. It doesn't modify the pointees,
+    // but it wants to reorder the pointers, so present a copy of them.
+    std::vector<char*> argv_for_benchmark;
+
+    // argv[0] is expected to contain the binary name. It's only for logging purposes, don't bother.
+    argv_for_benchmark.push_back(nullptr);
+
+    // Images are sprite sheets to benchmark importing, other files are parks whose objects get loaded
+    // and anything else is a benchmark option.
+    std::vector<std::string> sheets;
+    std::vector<std::string> parks;
+    for (int i = 0; i < argc; i++)
+    {
+        if (File::Exists(argv[i]))
+        {
+            if (String::Equals(Path::GetExtension(argv[i]), ".png", true))
+            {
+                sheets.emplace_back(argv[i]);
+            }
+            else
+            {
+                parks.emplace_back(argv[i]);
+            }
+        }
+        else
+        {
+            argv_for_benchmark.push_back(const_cast<char*>(argv[i]));
+        }
+    }
+    argc = static_cast<int>(argv_for_benchmark.size());
+    ::benchmark::Initialize(&argc, &argv_for_benchmark[0]);
+    if (::benchmark::ReportUnrecognizedArguments(argc, &argv_for_benchmark[0]))
+        return -1;
+
+    Platform::CoreInit();
+    gOpenRCT2Headless = true;
+
+    // The growth of the resident set shows how much of the graphics each process keeps a private copy of.
+    benchmark::RegisterBenchmark("load graphics [mapped]", BM_load_graphics, true);
+    benchmark::RegisterBenchmark("load graphics [read]", BM_load_graphics, false);
+    for (const auto& sheet : sheets)
+    {
+        RegisterImportBenchmarks(sheet);
+    }
+    for (const auto& park : parks)
+    {
+        benchmark::RegisterBenchmark(("load objects " + park).c_str(), BM_load_objects, park)->UseRealTime();
+    }
+    ::benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
+
+static exitcode_t HandleBenchGraphics(CommandLineArgEnumerator* argEnumerator)
+{
+    const char* const* argv = static_cast<const char* const*>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+    int32_t result = CmdlineForBenchGraphics(argc, argv);
+    if (result < 0)
+    {
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
+
+#else
+static exitcode_t HandleBenchGraphics(CommandLineArgEnumerator* argEnumerator)
+{
+    log_error("Sorry, Google benchmark not enabled in this build");
+    return EXITCODE_FAIL;
+}
+#endif // USE_BENCHMARK
+
+const CommandLineCommand CommandLine::BenchGraphicsCommands[]{
+#ifdef USE_BENCHMARK
+    DefineCommand(
+        "",
+        "[<sprite_sheet>|<park_file>...] [--benchmark_list_tests={true|false}] [--benchmark_filter=<regex>] "
+        "[--benchmark_min_time=<min_time>] "
+        "[--benchmark_repetitions=<num_repetitions>] [--benchmark_report_aggregates_only={true|false}] "
+        "[--benchmark_format=<console|json|csv>] [--benchmark_out=<filename>] [--benchmark_out_format=<json|console|csv>] "
+        "[--benchmark_color={auto|true|false}] [--benchmark_counters_tabular={true|false}] [--v=<verbosity>]",
+        nullptr, HandleBenchGraphics),
+    CommandTableEnd
+#else
+    DefineCommand("", "*** SORRY NOT ENABLED IN THIS BUILD ***", nullptr, HandleBenchGraphics), CommandTableEnd
+#endif // USE_BENCHMARK
+};
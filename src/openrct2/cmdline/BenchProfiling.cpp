@@ -0,0 +1,135 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2022 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "CommandLine.hpp"
+
+#ifdef USE_BENCHMARK
+
+#    include "../profiling/Profiling.h"
+
+#    include <algorithm>
+#    include <benchmark/benchmark.h>
+#    include <cstdint>
+#    include <thread>
+#    include <vector>
+
+using namespace OpenRCT2;
+
+static int32_t _benchmarkSink;
+
+static void ProfiledLeaf()
+{
+    PROFILED_FUNCTION();
+    benchmark::DoNotOptimize(_benchmarkSink);
+}
+
+static void ProfiledParent()
+{
+    PROFILED_FUNCTION();
+    ProfiledLeaf();
+}
+
+// Measures what the profiler adds to every call of a profiled function. Each thread calls the same function so
+// any contention between threads shows up as the time per call growing with the thread count. Only the first
+// thread switches the profiler, so the others do not write the shared flag while it is being read.
+static void BM_profiled_call(benchmark::State& state, bool enabled, bool nested)
+{
+    if (state.thread_index() == 0)
+    {
+        if (enabled)
+        {
+            Profiling::Enable();
+        }
+        else
+        {
+            Profiling::Disable();
+        }
+    }
+
+    for (auto _ : state)
+    {
+        if (nested)
+        {
+            ProfiledParent();
+        }
+        else
+        {
+            ProfiledLeaf();
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    if (state.thread_index() == 0)
+    {
+        Profiling::Disable();
+    }
+}
+
+static int CmdlineForBenchProfiling(int argc, const char* const* argv)
+{
+    // Google benchmark does stuff to argv. It doesn't modify the pointees,
+    // but it wants to reorder the pointers, so present a copy of them.
+    std::vector<char*> argv_for_benchmark;
+
+    // argv[0] is expected to contain the binary name. It's only for logging purposes, don't bother.
+    argv_for_benchmark.push_back(nullptr);
+    for (int i = 0; i < argc; i++)
+    {
+        argv_for_benchmark.push_back(const_cast<char*>(argv[i]));
+    }
+    argc = static_cast<int>(argv_for_benchmark.size());
+    ::benchmark::Initialize(&argc, &argv_for_benchmark[0]);
+    if (::benchmark::ReportUnrecognizedArguments(argc, &argv_for_benchmark[0]))
+        return -1;
+
+    const auto maxThreads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    benchmark::RegisterBenchmark("profiled call [disabled]", BM_profiled_call, false, false);
+    benchmark::RegisterBenchmark("profiled call [enabled]", BM_profiled_call, true, false)->ThreadRange(1, maxThreads);
+    benchmark::RegisterBenchmark("profiled nested call [enabled]", BM_profiled_call, true, true)
+        ->ThreadRange(1, maxThreads);
+    ::benchmark::RunSpecifiedBenchmarks();
+
+    Profiling::ResetData();
+    return 0;
+}
+
+static exitcode_t HandleBenchProfiling(CommandLineArgEnumerator* argEnumerator)
+{
+    const char* const* argv = static_cast<const char* const*>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+    int32_t result = CmdlineForBenchProfiling(argc, argv);
+    if (result < 0)
+    {
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
+
+#else
+static exitcode_t HandleBenchProfiling(CommandLineArgEnumerator* argEnumerator)
+{
+    log_error("Sorry, Google benchmark not enabled in this build");
+    return EXITCODE_FAIL;
+}
+#endif // USE_BENCHMARK
+
+const CommandLineCommand CommandLine::BenchProfilingCommands[]{
+#ifdef USE_BENCHMARK
+    DefineCommand(
+        "",
+        "[--benchmark_list_tests={true|false}] [--benchmark_filter=<regex>] [--benchmark_min_time=<min_time>] "
+        "[--benchmark_repetitions=<num_repetitions>] [--benchmark_report_aggregates_only={true|false}] "
+        "[--benchmark_format=<console|json|csv>] [--benchmark_out=<filename>] [--benchmark_out_format=<json|console|csv>] "
+        "[--benchmark_color={auto|true|false}] [--benchmark_counters_tabular={true|false}] [--v=<verbosity>]",
+        nullptr, HandleBenchProfiling),
+    CommandTableEnd
+#else
+    DefineCommand("", "*** SORRY NOT ENABLED IN THIS BUILD ***", nullptr, HandleBenchProfiling), CommandTableEnd
+#endif // USE_BENCHMARK
+};
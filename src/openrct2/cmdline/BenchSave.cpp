@@ -0,0 +1,178 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2022 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "CommandLine.hpp"
+
+#ifdef USE_BENCHMARK
+
+#    include "../Context.h"
+#    include "../OpenRCT2.h"
+#    include "../config/Config.h"
+#    include "../core/Compression.h"
+#    include "../core/File.h"
+#    include "../core/MemoryStream.h"
+#    include "../park/ParkFile.h"
+#    include "../platform/Platform.h"
+
+#    include <benchmark/benchmark.h>
+#    include <cstdint>
+#    include <string>
+#    include <vector>
+
+using namespace OpenRCT2;
+
+static std::unique_ptr<IContext> CreateBenchContext(
+    benchmark::State& state, const std::string& filename, CompressionType type, int32_t level)
+{
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        state.SkipWithError("Context initialization failed.");
+        return nullptr;
+    }
+    if (!context->LoadParkFromFile(filename))
+    {
+        state.SkipWithError("Failed to load file!");
+        return nullptr;
+    }
+    gConfigGeneral.save_compression = type;
+    gConfigGeneral.save_compression_level = level;
+    return context;
+}
+
+static MemoryStream SavePark()
+{
+    MemoryStream ms;
+    auto exporter = std::make_unique<ParkFileExporter>();
+    exporter->Export(ms);
+    return ms;
+}
+
+static void BM_save(benchmark::State& state, const std::string& filename, CompressionType type, int32_t level)
+{
+    auto context = CreateBenchContext(state, filename, type, level);
+    if (context == nullptr)
+        return;
+
+    uint64_t size = 0;
+    for (auto _ : state)
+    {
+        auto ms = SavePark();
+        size = ms.GetLength();
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["Size_KiB"] = static_cast<double>(size) / 1024;
+}
+
+static void BM_load(benchmark::State& state, const std::string& filename, CompressionType type, int32_t level)
+{
+    auto context = CreateBenchContext(state, filename, type, level);
+    if (context == nullptr)
+        return;
+
+    auto ms = SavePark();
+    for (auto _ : state)
+    {
+        ms.SetPosition(0);
+        if (!context->LoadParkFromStream(&ms, filename))
+        {
+            state.SkipWithError("Failed to load saved park!");
+            break;
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["Size_KiB"] = static_cast<double>(ms.GetLength()) / 1024;
+}
+
+static void RegisterBenchmarks(const std::string& filename, CompressionType type, int32_t level)
+{
+    auto name = filename + " [" + std::string(Compression::GetTypeName(type));
+    if (level != Compression::DefaultLevel)
+    {
+        name += " " + std::to_string(level);
+    }
+    name += "]";
+    benchmark::RegisterBenchmark(("save " + name).c_str(), BM_save, filename, type, level);
+    benchmark::RegisterBenchmark(("load " + name).c_str(), BM_load, filename, type, level);
+}
+
+static int CmdlineForBenchSave(int argc, const char* const* argv)
+{
+    // Google benchmark does stuff to argv. It doesn't modify the pointees,
+    // but it wants to reorder the pointers, so present a copy of them.
+    std::vector<char*> argv_for_benchmark;
+
+    // argv[0] is expected to contain the binary name. It's only for logging purposes, don't bother.
+    argv_for_benchmark.push_back(nullptr);
+
+    // Extract file names from argument list. If there is no such file, consider it benchmark option.
+    for (int i = 0; i < argc; i++)
+    {
+        if (File::Exists(argv[i]))
+        {
+            // Compare the default gzip level against zstd at its default and a fast level
+            RegisterBenchmarks(argv[i], CompressionType::Gzip, Compression::DefaultLevel);
+            if (Compression::IsSupported(CompressionType::Zstd))
+            {
+                RegisterBenchmarks(argv[i], CompressionType::Zstd, Compression::DefaultLevel);
+                RegisterBenchmarks(argv[i], CompressionType::Zstd, 1);
+            }
+        }
+        else
+        {
+            argv_for_benchmark.push_back(const_cast<char*>(argv[i]));
+        }
+    }
+    // Update argc with all the changes made
+    argc = static_cast<int>(argv_for_benchmark.size());
+    ::benchmark::Initialize(&argc, &argv_for_benchmark[0]);
+    if (::benchmark::ReportUnrecognizedArguments(argc, &argv_for_benchmark[0]))
+        return -1;
+
+    Platform::CoreInit();
+    gOpenRCT2Headless = true;
+
+    ::benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
+
+static exitcode_t HandleBenchSave(CommandLineArgEnumerator* argEnumerator)
+{
+    const char* const* argv = static_cast<const char* const*>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+    int32_t result = CmdlineForBenchSave(argc, argv);
+    if (result < 0)
+    {
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
+
+#else
+static exitcode_t HandleBenchSave(CommandLineArgEnumerator* argEnumerator)
+{
+    log_error("Sorry, Google benchmark not enabled in this build");
+    return EXITCODE_FAIL;
+}
+#endif // USE_BENCHMARK
+
+const CommandLineCommand CommandLine::BenchSaveCommands[]{
+#ifdef USE_BENCHMARK
+    DefineCommand(
+        "",
+        "<file>... [--benchmark_list_tests={true|false}] [--benchmark_filter=<regex>] [--benchmark_min_time=<min_time>] "
+        "[--benchmark_repetitions=<num_repetitions>] [--benchmark_report_aggregates_only={true|false}] "
+        "[--benchmark_format=<console|json|csv>] [--benchmark_out=<filename>] [--benchmark_out_format=<json|console|csv>] "
+        "[--benchmark_color={auto|true|false}] [--benchmark_counters_tabular={true|false}] [--v=<verbosity>]",
+        nullptr, HandleBenchSave),
+    CommandTableEnd
+#else
+    DefineCommand("", "*** SORRY NOT ENABLED IN THIS BUILD ***", nullptr, HandleBenchSave), CommandTableEnd
+#endif // USE_BENCHMARK
+};
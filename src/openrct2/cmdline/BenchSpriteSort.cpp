@@ -132,7 +132,8 @@ static std::vector<RecordedPaintSession> extract_paint_session(std::string_view
 }
 
 // This function is based on benchgfx_render_screenshots
-static void BM_paint_session_arrange(benchmark::State& state, const std::vector<RecordedPaintSession> inputSessions)
+static void BM_paint_session_arrange(
+    benchmark::State& state, const std::vector<RecordedPaintSession> inputSessions, PaintSortNeighboursFn sortNeighboursFn)
 {
     auto sessions = inputSessions;
     // Fixing up the pointers continuously is wasteful. Fix it up once for `sessions` and store a copy.
@@ -146,13 +147,56 @@ static void BM_paint_session_arrange(benchmark::State& state, const std::vector<
         state.PauseTiming();
         std::copy_n(local_s, std::size(sessions), sessions.begin());
         state.ResumeTiming();
-        PaintSessionArrange(sessions[0].Session);
+        PaintSessionArrange(sessions[0].Session, sortNeighboursFn);
         benchmark::DoNotOptimize(sessions);
     }
     state.SetItemsProcessed(state.iterations() * std::size(sessions));
     delete[] local_s;
 }
 
+// Arranges every session and returns the resulting draw orders as indices into the recorded entries.
+static std::vector<std::vector<size_t>> get_draw_orders(
+    const std::vector<RecordedPaintSession>& inputSessions, PaintSortNeighboursFn sortNeighboursFn)
+{
+    auto sessions = inputSessions;
+    fixup_pointers(sessions);
+
+    std::vector<std::vector<size_t>> drawOrders;
+    for (auto& session : sessions)
+    {
+        PaintSessionArrange(session.Session, sortNeighboursFn);
+
+        auto& drawOrder = drawOrders.emplace_back();
+        for (auto* ps = session.Session.PaintHead.next_quadrant_ps; ps != nullptr; ps = ps->next_quadrant_ps)
+        {
+            drawOrder.push_back(reinterpret_cast<paint_entry*>(ps) - session.Entries.data());
+        }
+    }
+    return drawOrders;
+}
+
+static bool register_benchmarks(const std::string& name, const std::vector<RecordedPaintSession>& sessions)
+{
+    benchmark::RegisterBenchmark(name.c_str(), BM_paint_session_arrange, sessions, nullptr);
+
+    // The SIMD arrangement must give the same draw order as walking the lists.
+    const auto expectedDrawOrders = get_draw_orders(sessions, nullptr);
+    auto registerSIMD = [&](const char* suffix, PaintSortNeighboursFn sortNeighboursFn) {
+        if (get_draw_orders(sessions, sortNeighboursFn) != expectedDrawOrders)
+        {
+            log_error("%s draw order differs from the list walk for %s", suffix, name.c_str());
+            return false;
+        }
+        benchmark::RegisterBenchmark((name + "/" + suffix).c_str(), BM_paint_session_arrange, sessions, sortNeighboursFn);
+        return true;
+    };
+    if (sse41_available() && !registerSIMD("sse4.1", paint_sort_neighbours_sse4_1))
+        return false;
+    if (avx2_available() && !registerSIMD("avx2", paint_sort_neighbours_avx2))
+        return false;
+    return true;
+}
+
 static int cmdline_for_bench_sprite_sort(int argc, const char** argv)
 {
     {
@@ -166,7 +210,7 @@ static int cmdline_for_bench_sprite_sort(int argc, const char** argv)
         {
             quad = reinterpret_cast<paint_struct*>(-1);
         }
-        benchmark::RegisterBenchmark("baseline", BM_paint_session_arrange, sessions);
+        benchmark::RegisterBenchmark("baseline", BM_paint_session_arrange, sessions, nullptr);
     }
 
     // Google benchmark does stuff to argv. It doesn't modify the pointees,
@@ -183,8 +227,8 @@ static int cmdline_for_bench_sprite_sort(int argc, const char** argv)
         {
             // Register benchmark for sv6 if valid
             std::vector<RecordedPaintSession> sessions = extract_paint_session(argv[i]);
-            if (!sessions.empty())
-                benchmark::RegisterBenchmark(argv[i], BM_paint_session_arrange, sessions);
+            if (!sessions.empty() && !register_benchmarks(argv[i], sessions))
+                return -1;
         }
         else
         {
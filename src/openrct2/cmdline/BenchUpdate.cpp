@@ -14,6 +14,7 @@
 #    include "../Context.h"
 #    include "../GameState.h"
 #    include "../OpenRCT2.h"
+#    include "../config/Config.h"
 #    include "../core/File.h"
 #    include "../platform/Platform.h"
 
@@ -25,11 +26,12 @@
 
 using namespace OpenRCT2;
 
-static void BM_update(benchmark::State& state, const std::string& filename)
+static void BM_update(benchmark::State& state, const std::string& filename, bool multithreadedGuestUpdate)
 {
     std::unique_ptr<IContext> context(CreateContext());
     if (context->Initialise())
     {
+        gConfigGeneral.multithreaded_guest_update = multithreadedGuestUpdate;
         if (!filename.empty() && !context->LoadParkFromFile(filename))
         {
             state.SkipWithError("Failed to load file!");
@@ -90,7 +92,7 @@ static void BM_update(benchmark::State& state, const std::string& filename)
 static int CmdlineForBenchSpriteSort(int argc, const char* const* argv)
 {
     // Add a baseline test on an empty park
-    benchmark::RegisterBenchmark("baseline", BM_update, std::string{});
+    benchmark::RegisterBenchmark("baseline", BM_update, std::string{}, false);
 
     // Google benchmark does stuff to argv. It doesn't modify the pointees,
     // but it wants to reorder the pointers, so present a copy of them.
@@ -104,8 +106,10 @@ static int CmdlineForBenchSpriteSort(int argc, const char* const* argv)
     {
         if (File::Exists(argv[i]))
         {
-            // Register benchmark for sv6 if valid
-            benchmark::RegisterBenchmark(argv[i], BM_update, argv[i]);
+            // Register benchmark for sv6 if valid, once for each guest update mode
+            benchmark::RegisterBenchmark(argv[i], BM_update, argv[i], false);
+            benchmark::RegisterBenchmark(
+                (std::string(argv[i]) + " [multithreaded guests]").c_str(), BM_update, argv[i], true);
         }
         else
         {
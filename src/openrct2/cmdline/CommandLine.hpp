@@ -119,6 +119,9 @@ namespace CommandLine
     extern const CommandLineCommand BenchGfxCommands[];
     extern const CommandLineCommand BenchSpriteSortCommands[];
     extern const CommandLineCommand BenchUpdateCommands[];
+    extern const CommandLineCommand BenchSaveCommands[];
+    extern const CommandLineCommand BenchGraphicsCommands[];
+    extern const CommandLineCommand BenchProfilingCommands[];
     extern const CommandLineCommand SimulateCommands[];
 
     extern const CommandLineExample RootExamples[];
@@ -12,6 +12,7 @@
 #include "../PlatformEnvironment.h"
 #include "../Version.h"
 #include "../config/Config.h"
+#include "../core/Compression.h"
 #include "../core/Console.hpp"
 #include "../core/File.h"
 #include "../core/Guard.hpp"
@@ -24,11 +25,13 @@
 #include "../park/ParkFile.h"
 #include "../platform/Crash.h"
 #include "../platform/Platform.h"
+#include "../profiling/TickStats.h"
 #include "../scripting/ScriptEngine.h"
 #include "CommandLine.hpp"
 
 #include <ctime>
 #include <iterator>
+#include <limits>
 #include <string>
 
 #ifdef USE_BREAKPAD
@@ -60,6 +63,13 @@ static u8string _openrct2DataPath = {};
 static u8string _rct1DataPath = {};
 static u8string _rct2DataPath = {};
 static bool _silentBreakpad = false;
+static u8string _compression = {};
+// Level 0 selects the default level of the codec, so it can not mean the option was not given.
+static constexpr int32_t CompressionLevelNotSet = std::numeric_limits<int32_t>::min();
+static int32_t _compressionLevel = CompressionLevelNotSet;
+static u8string _profileTrace = {};
+static u8string _tickStats = {};
+static int32_t _tickStatsPeriod = 0;
 
 // clang-format off
 static constexpr const CommandLineOptionDefinition StandardOptions[]
@@ -80,6 +90,11 @@ static constexpr const CommandLineOptionDefinition StandardOptions[]
     { CMDLINE_TYPE_STRING,  &_openrct2DataPath, NAC, "openrct2-data-path", "path to the OpenRCT2 data directory (containing languages)" },
     { CMDLINE_TYPE_STRING,  &_rct1DataPath,     NAC, "rct1-data-path",     "path to the RollerCoaster Tycoon 1 data directory (containing data/csg1.dat)" },
     { CMDLINE_TYPE_STRING,  &_rct2DataPath,     NAC, "rct2-data-path",     "path to the RollerCoaster Tycoon 2 data directory (containing data/g1.dat)" },
+    { CMDLINE_TYPE_STRING,  &_compression,      NAC, "compression",        "compression for saves and replays (none, gzip or zstd)" },
+    { CMDLINE_TYPE_INTEGER, &_compressionLevel, NAC, "compression-level",  "compression level, 0 uses the default level of the codec" },
+    { CMDLINE_TYPE_STRING,  &_profileTrace,     NAC, "profile-trace",      "record a profiler trace and write it to the given file on exit" },
+    { CMDLINE_TYPE_STRING,  &_tickStats,        NAC, "tick-stats",         "append the tick time percentiles and entity counts to the given .csv or JSON lines file" },
+    { CMDLINE_TYPE_INTEGER, &_tickStatsPeriod,  NAC, "tick-stats-period",  "number of ticks between writes of the tick stats, defaults to 1024" },
 #ifdef USE_BREAKPAD
     { CMDLINE_TYPE_SWITCH,  &_silentBreakpad,  NAC, "silent-breakpad",   "make breakpad crash reporting silent"                       },
 #endif // USE_BREAKPAD
@@ -143,6 +158,9 @@ const CommandLineCommand CommandLine::RootCommands[]
     DefineSubCommand("benchgfx",        CommandLine::BenchGfxCommands         ),
     DefineSubCommand("benchspritesort", CommandLine::BenchSpriteSortCommands  ),
     DefineSubCommand("benchsimulate",   CommandLine::BenchUpdateCommands      ),
+    DefineSubCommand("benchsave",       CommandLine::BenchSaveCommands        ),
+    DefineSubCommand("benchgraphics",   CommandLine::BenchGraphicsCommands    ),
+    DefineSubCommand("benchprofiling",  CommandLine::BenchProfilingCommands   ),
     DefineSubCommand("simulate",        CommandLine::SimulateCommands         ),
     CommandTableEnd
 };
@@ -224,6 +242,32 @@ exitcode_t CommandLine::HandleCommandDefault()
         gCustomPassword = _password;
     }
 
+    if (!_profileTrace.empty())
+    {
+        gProfileTracePath = Path::GetAbsolute(_profileTrace);
+    }
+
+    if (!_tickStats.empty())
+    {
+        auto period = _tickStatsPeriod > 0 ? static_cast<uint32_t>(_tickStatsPeriod) : OpenRCT2::TickStats::WindowSize;
+        OpenRCT2::TickStats::SetDumpFile(Path::GetAbsolute(_tickStats), static_cast<uint32_t>(period));
+    }
+
+    if (!_compression.empty())
+    {
+        auto type = Compression::ParseType(_compression);
+        if (!type.has_value() || !Compression::IsSupported(*type))
+        {
+            Console::Error::WriteLine("Compression '%s' is not supported by this build.", _compression.c_str());
+            return EXITCODE_FAIL;
+        }
+        gCustomCompression = _compression;
+    }
+    if (_compressionLevel != CompressionLevelNotSet)
+    {
+        gCustomCompressionLevel = _compressionLevel;
+    }
+
     return result;
 }
 
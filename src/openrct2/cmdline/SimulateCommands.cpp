@@ -11,22 +11,149 @@
 #include "../Game.h"
 #include "../GameState.h"
 #include "../OpenRCT2.h"
+#include "../config/Config.h"
 #include "../core/Console.hpp"
+#include "../core/JobPool.h"
+#include "../core/Path.hpp"
 #include "../entity/EntityRegistry.h"
 #include "../network/network.h"
 #include "../platform/Platform.h"
+#include "../profiling/Profiling.h"
 #include "CommandLine.hpp"
 
+#include <atomic>
 #include <cstdlib>
 #include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifndef _WIN32
+#    include <sys/wait.h>
+#endif
 
 using namespace OpenRCT2;
 
+static bool _multithreadedGuests;
+static u8string _profileTrace;
+static int32_t _jobs = 1;
+static u8string _userDataPath;
+static u8string _openrct2DataPath;
+static u8string _rct1DataPath;
+static u8string _rct2DataPath;
+
+// clang-format off
+static constexpr const CommandLineOptionDefinition SimulateOptions[]
+{
+    { CMDLINE_TYPE_SWITCH,  &_multithreadedGuests, NAC, "multithreaded-guests", "survey guest surroundings on worker threads" },
+    { CMDLINE_TYPE_STRING,  &_profileTrace,        NAC, "profile-trace",        "record a profiler trace of the ticks and write it to the given file" },
+    { CMDLINE_TYPE_INTEGER, &_jobs,                'j', "jobs",                 "number of parks to simulate at once, each in its own process (not supported on Windows)" },
+    { CMDLINE_TYPE_STRING,  &_userDataPath,        NAC, "user-data-path",       "path to the user data directory (containing config.ini)" },
+    { CMDLINE_TYPE_STRING,  &_openrct2DataPath,    NAC, "openrct2-data-path",   "path to the OpenRCT2 data directory (containing languages)" },
+    { CMDLINE_TYPE_STRING,  &_rct1DataPath,        NAC, "rct1-data-path",       "path to the RollerCoaster Tycoon 1 data directory (containing data/csg1.dat)" },
+    { CMDLINE_TYPE_STRING,  &_rct2DataPath,        NAC, "rct2-data-path",       "path to the RollerCoaster Tycoon 2 data directory (containing data/g1.dat)" },
+    OptionTableEnd
+};
+
 static exitcode_t HandleSimulate(CommandLineArgEnumerator* argEnumerator);
 
-const CommandLineCommand CommandLine::SimulateCommands[]{ // Main commands
-                                                          DefineCommand("", "<ticks>", nullptr, HandleSimulate), CommandTableEnd
+const CommandLineCommand CommandLine::SimulateCommands[]
+{
+    // Main commands
+    DefineCommand("", "<file> [<file>...] <ticks>", SimulateOptions, HandleSimulate),
+    CommandTableEnd
 };
+// clang-format on
+
+#ifndef _WIN32
+static std::string QuoteArgument(std::string_view argument)
+{
+    std::string result = "'";
+    for (auto c : argument)
+    {
+        if (c == '\'')
+            result += "'\\''";
+        else
+            result += c;
+    }
+    return result + "'";
+}
+#endif
+
+// The game state lives in globals, so parks that are simulated at the same time each get a process of their own.
+static exitcode_t SimulateInProcesses(
+    [[maybe_unused]] const std::vector<u8string>& inputPaths, [[maybe_unused]] uint32_t ticks)
+{
+#ifdef _WIN32
+    Console::Error::WriteLine("Simulating several parks at once is not supported on Windows, omit --jobs.");
+    return EXITCODE_FAIL;
+#else
+    auto command = QuoteArgument(Platform::GetCurrentExecutablePath()) + " simulate";
+    if (_multithreadedGuests)
+    {
+        command += " --multithreaded-guests";
+    }
+
+    // The parks have to be loaded with the same config and data as they would be in this process.
+    const std::pair<const char*, const u8string&> paths[] = {
+        { "--user-data-path", gCustomUserDataPath },
+        { "--openrct2-data-path", gCustomOpenRCT2DataPath },
+        { "--rct1-data-path", gCustomRCT1DataPath },
+        { "--rct2-data-path", gCustomRCT2DataPath },
+    };
+    for (const auto& [option, path] : paths)
+    {
+        if (!path.empty())
+        {
+            command += " " + std::string(option) + " " + QuoteArgument(path);
+        }
+    }
+
+    std::mutex outputMutex;
+    std::atomic<bool> failed{};
+    JobPool jobPool(static_cast<size_t>(_jobs));
+    for (const auto& inputPath : inputPaths)
+    {
+        jobPool.AddTask([&, inputPath]() {
+            std::string output;
+            auto status = Platform::Execute(
+                command + " " + QuoteArgument(inputPath) + " " + std::to_string(ticks) + " 2>&1", &output);
+
+            std::scoped_lock lock(outputMutex);
+            std::istringstream lines(output);
+            std::string line;
+            while (std::getline(lines, line))
+            {
+                Console::WriteLine("%s: %s", inputPath.c_str(), line.c_str());
+            }
+            if (status == -1)
+            {
+                Console::Error::WriteLine("%s: unable to start the simulation.", inputPath.c_str());
+                failed = true;
+            }
+            else if (WIFSIGNALED(status))
+            {
+                Console::Error::WriteLine("%s: simulation killed by signal %d.", inputPath.c_str(), WTERMSIG(status));
+                failed = true;
+            }
+            else if (!WIFEXITED(status))
+            {
+                Console::Error::WriteLine("%s: simulation failed.", inputPath.c_str());
+                failed = true;
+            }
+            else if (WEXITSTATUS(status) != 0)
+            {
+                Console::Error::WriteLine("%s: simulation failed (%d).", inputPath.c_str(), WEXITSTATUS(status));
+                failed = true;
+            }
+        });
+    }
+    jobPool.Join();
+    return failed ? EXITCODE_FAIL : EXITCODE_OK;
+#endif
+}
 
 static exitcode_t HandleSimulate(CommandLineArgEnumerator* argEnumerator)
 {
@@ -35,14 +162,43 @@ static exitcode_t HandleSimulate(CommandLineArgEnumerator* argEnumerator)
 
     if (argc < 2)
     {
-        Console::Error::WriteLine("Missing arguments <sv6-file> <ticks>.");
+        Console::Error::WriteLine("Missing arguments <sv6-file> [<sv6-file>...] <ticks>.");
         return EXITCODE_FAIL;
     }
 
     Platform::CoreInit();
 
-    const char* inputPath = argv[0];
-    uint32_t ticks = atol(argv[1]);
+    if (!_userDataPath.empty())
+    {
+        gCustomUserDataPath = Path::GetAbsolute(_userDataPath);
+    }
+    if (!_openrct2DataPath.empty())
+    {
+        gCustomOpenRCT2DataPath = Path::GetAbsolute(_openrct2DataPath);
+    }
+    if (!_rct1DataPath.empty())
+    {
+        gCustomRCT1DataPath = _rct1DataPath;
+    }
+    if (!_rct2DataPath.empty())
+    {
+        gCustomRCT2DataPath = _rct2DataPath;
+    }
+
+    std::vector<u8string> inputPaths(argv, argv + argc - 1);
+    uint32_t ticks = atol(argv[argc - 1]);
+
+    if (_jobs > 1 && !_profileTrace.empty())
+    {
+        // The parks would be simulated in other processes, each with a trace of its own.
+        Console::Error::WriteLine("--profile-trace can not be used together with --jobs.");
+        return EXITCODE_FAIL;
+    }
+
+    if (inputPaths.size() > 1 && _jobs > 1)
+    {
+        return SimulateInProcesses(inputPaths, ticks);
+    }
 
     gOpenRCT2Headless = true;
 
@@ -53,23 +209,50 @@ static exitcode_t HandleSimulate(CommandLineArgEnumerator* argEnumerator)
     std::unique_ptr<IContext> context(CreateContext());
     if (context->Initialise())
     {
-        if (!context->LoadParkFromFile(inputPath))
+        gConfigGeneral.multithreaded_guest_update = _multithreadedGuests;
+
+        if (!_profileTrace.empty())
         {
-            return EXITCODE_FAIL;
+            Profiling::SetThreadName("Main");
+            Profiling::Enable();
+            Profiling::StartTrace();
         }
 
-        Console::WriteLine("Running %d ticks...", ticks);
-        for (uint32_t i = 0; i < ticks; i++)
+        auto result = EXITCODE_OK;
+        for (const auto& inputPath : inputPaths)
         {
-            context->GetGameState()->UpdateLogic();
+            if (inputPaths.size() > 1)
+            {
+                Console::WriteLine("Simulating %s", inputPath.c_str());
+            }
+            if (!context->LoadParkFromFile(inputPath))
+            {
+                result = EXITCODE_FAIL;
+                continue;
+            }
+
+            Console::WriteLine("Running %d ticks...", ticks);
+            for (uint32_t i = 0; i < ticks; i++)
+            {
+                context->GetGameState()->UpdateLogic();
+            }
+            Console::WriteLine("Completed: %s", GetAllEntitiesChecksum().ToString().c_str());
         }
-        Console::WriteLine("Completed: %s", GetAllEntitiesChecksum().ToString().c_str());
-    }
-    else
-    {
-        Console::Error::WriteLine("Context initialization failed.");
-        return EXITCODE_FAIL;
+
+        if (!_profileTrace.empty())
+        {
+            Profiling::Disable();
+            Profiling::StopTrace();
+            if (!Profiling::ExportTrace(_profileTrace))
+            {
+                Console::Error::WriteLine("Unable to write profiler trace to %s", _profileTrace.c_str());
+                return EXITCODE_FAIL;
+            }
+            Console::WriteLine("Wrote profiler trace to %s", _profileTrace.c_str());
+        }
+        return result;
     }
 
-    return EXITCODE_OK;
+    Console::Error::WriteLine("Context initialization failed.");
+    return EXITCODE_FAIL;
 }
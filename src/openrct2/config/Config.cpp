@@ -87,6 +87,12 @@ namespace Config
         ConfigEnumEntry<DrawingEngine>("OPENGL", DrawingEngine::OpenGL),
     });
 
+    static const auto Enum_Compression = ConfigEnum<CompressionType>({
+        ConfigEnumEntry<CompressionType>("NONE", CompressionType::None),
+        ConfigEnumEntry<CompressionType>("GZIP", CompressionType::Gzip),
+        ConfigEnumEntry<CompressionType>("ZSTD", CompressionType::Zstd),
+    });
+
     static const auto Enum_Temperature = ConfigEnum<TemperatureUnit>({
         ConfigEnumEntry<TemperatureUnit>("CELSIUS", TemperatureUnit::Celsius),
         ConfigEnumEntry<TemperatureUnit>("FAHRENHEIT", TemperatureUnit::Fahrenheit),
@@ -141,6 +147,9 @@ namespace Config
             model->always_show_gridlines = reader->GetBoolean("always_show_gridlines", false);
             model->autosave_frequency = reader->GetInt32("autosave", AUTOSAVE_EVERY_5MINUTES);
             model->autosave_amount = reader->GetInt32("autosave_amount", DEFAULT_NUM_AUTOSAVES_TO_KEEP);
+            model->save_compression = reader->GetEnum<CompressionType>(
+                "save_compression", CompressionType::Gzip, Enum_Compression);
+            model->save_compression_level = reader->GetInt32("save_compression_level", Compression::DefaultLevel);
             model->confirmation_prompt = reader->GetBoolean("confirmation_prompt", false);
             model->currency_format = reader->GetEnum<CurrencyType>(
                 "currency_format", Platform::GetLocaleCurrency(), Enum_Currency);
@@ -197,6 +206,8 @@ namespace Config
             model->window_scale = reader->GetFloat("window_scale", Platform::GetDefaultScale());
             model->show_fps = reader->GetBoolean("show_fps", false);
             model->multithreading = reader->GetBoolean("multi_threading", false);
+            model->multithreaded_guest_update = reader->GetBoolean("multithreaded_guest_update", false);
+            model->cache_static_tiles = reader->GetBoolean("cache_static_tiles", false);
             model->trap_cursor = reader->GetBoolean("trap_cursor", false);
             model->auto_open_shops = reader->GetBoolean("auto_open_shops", false);
             model->scenario_select_mode = reader->GetInt32("scenario_select_mode", SCENARIO_SELECT_MODE_ORIGIN);
@@ -227,6 +238,8 @@ namespace Config
         writer->WriteBoolean("always_show_gridlines", model->always_show_gridlines);
         writer->WriteInt32("autosave", model->autosave_frequency);
         writer->WriteInt32("autosave_amount", model->autosave_amount);
+        writer->WriteEnum<CompressionType>("save_compression", model->save_compression, Enum_Compression);
+        writer->WriteInt32("save_compression_level", model->save_compression_level);
         writer->WriteBoolean("confirmation_prompt", model->confirmation_prompt);
         writer->WriteEnum<CurrencyType>("currency_format", model->currency_format, Enum_Currency);
         writer->WriteInt32("custom_currency_rate", model->custom_currency_rate);
@@ -273,6 +286,8 @@ namespace Config
         writer->WriteFloat("window_scale", model->window_scale);
         writer->WriteBoolean("show_fps", model->show_fps);
         writer->WriteBoolean("multi_threading", model->multithreading);
+        writer->WriteBoolean("multithreaded_guest_update", model->multithreaded_guest_update);
+        writer->WriteBoolean("cache_static_tiles", model->cache_static_tiles);
         writer->WriteBoolean("trap_cursor", model->trap_cursor);
         writer->WriteBoolean("auto_open_shops", model->auto_open_shops);
         writer->WriteInt32("scenario_select_mode", model->scenario_select_mode);
@@ -409,6 +424,7 @@ namespace Config
             model->log_server_actions = reader->GetBoolean("log_server_actions", false);
             model->pause_server_if_no_clients = reader->GetBoolean("pause_server_if_no_clients", false);
             model->desync_debugging = reader->GetBoolean("desync_debugging", false);
+            model->io_thread = reader->GetBoolean("io_thread", false);
         }
     }
 
@@ -436,6 +452,7 @@ namespace Config
         writer->WriteBoolean("log_server_actions", model->log_server_actions);
         writer->WriteBoolean("pause_server_if_no_clients", model->pause_server_if_no_clients);
         writer->WriteBoolean("desync_debugging", model->desync_debugging);
+        writer->WriteBoolean("io_thread", model->io_thread);
     }
 
     static void ReadNotifications(IIniReader* reader)
@@ -10,6 +10,7 @@
 #pragma once
 
 #include "../common.h"
+#include "../core/Compression.h"
 #include "../core/String.hpp"
 #include "../drawing/Drawing.h"
 #include "../localisation/Currency.h"
@@ -42,6 +43,8 @@ struct GeneralConfiguration
     bool use_vsync;
     bool show_fps;
     bool multithreading;
+    bool multithreaded_guest_update;
+    bool cache_static_tiles;
     bool minimize_fullscreen_focus_loss;
     bool disable_screensaver;
 
@@ -86,6 +89,8 @@ struct GeneralConfiguration
     bool debugging_tools;
     int32_t autosave_frequency;
     int32_t autosave_amount;
+    CompressionType save_compression;
+    int32_t save_compression_level;
     bool auto_staff_placement;
     bool handymen_mow_default;
     bool auto_open_shops;
@@ -162,6 +167,7 @@ struct NetworkConfiguration
     bool log_server_actions;
     bool pause_server_if_no_clients;
     bool desync_debugging;
+    bool io_thread;
 };
 
 struct NotificationConfiguration
@@ -23,6 +23,12 @@ namespace OpenRCT2
         *hash = Seed;
     }
 
+    ChecksumStream::ChecksumStream(std::array<std::byte, 20>& buf, std::vector<uint64_t>& words)
+        : ChecksumStream(buf)
+    {
+        _words = &words;
+    }
+
     void ChecksumStream::Write(const void* buffer, uint64_t length)
     {
         uint64_t* hash = reinterpret_cast<uint64_t*>(_checksum.data());
@@ -40,7 +46,24 @@ namespace OpenRCT2
 
             *hash ^= temp;
             *hash *= Prime;
+
+            if (_words != nullptr)
+            {
+                _words->push_back(temp);
+            }
+        }
+    }
+
+    void ChecksumStream::WriteWords(const uint64_t* words, size_t count)
+    {
+        uint64_t* hash = reinterpret_cast<uint64_t*>(_checksum.data());
+        auto value = *hash;
+        for (size_t i = 0; i < count; i++)
+        {
+            value ^= words[i];
+            value *= Prime;
         }
+        *hash = value;
     }
 
 #endif
@@ -13,6 +13,7 @@
 #include "IStream.hpp"
 
 #include <array>
+#include <vector>
 
 namespace OpenRCT2
 {
@@ -23,12 +24,15 @@ namespace OpenRCT2
     {
         // FIXME: Move the checksum implementation out.
         std::array<std::byte, 20>& _checksum;
+        std::vector<uint64_t>* _words = nullptr;
 
         static constexpr uint64_t Seed = 0xcbf29ce484222325ULL;
         static constexpr uint64_t Prime = 0x00000100000001B3ULL;
 
     public:
         ChecksumStream(std::array<std::byte, 20>& buf);
+        // Also records every word folded into the checksum, see WriteWords.
+        ChecksumStream(std::array<std::byte, 20>& buf, std::vector<uint64_t>& words);
 
         virtual ~ChecksumStream() = default;
 
@@ -73,6 +77,12 @@ namespace OpenRCT2
 
         void Write(const void* buffer, uint64_t length) override;
 
+        /**
+         * Folds words recorded by another stream into the checksum, this results in the same
+         * checksum as repeating the writes that recorded them.
+         */
+        void WriteWords(const uint64_t* words, size_t count);
+
         void Write1(const void* buffer) override
         {
             Write<1>(buffer);
@@ -0,0 +1,175 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2022 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "Compression.h"
+
+#include "../util/Util.h"
+#include "String.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+#ifdef USE_ZSTD
+#    include <zstd.h>
+#endif
+
+namespace Compression
+{
+    static constexpr uint8_t ZstdMagic[] = { 0x28, 0xB5, 0x2F, 0xFD };
+
+    bool IsSupported(CompressionType type)
+    {
+        switch (type)
+        {
+            case CompressionType::None:
+            case CompressionType::Gzip:
+                return true;
+            case CompressionType::Zstd:
+#ifdef USE_ZSTD
+                return true;
+#else
+                return false;
+#endif
+        }
+        return false;
+    }
+
+    std::optional<CompressionType> ParseType(std::string_view name)
+    {
+        for (auto type : { CompressionType::None, CompressionType::Gzip, CompressionType::Zstd })
+        {
+            if (String::Equals(name, GetTypeName(type), true))
+            {
+                return type;
+            }
+        }
+        return std::nullopt;
+    }
+
+    std::string_view GetTypeName(CompressionType type)
+    {
+        switch (type)
+        {
+            case CompressionType::None:
+                return "none";
+            case CompressionType::Gzip:
+                return "gzip";
+            case CompressionType::Zstd:
+                return "zstd";
+        }
+        return "unknown";
+    }
+
+    bool IsZstdFrame(const void* data, size_t dataLen)
+    {
+        return dataLen >= std::size(ZstdMagic)
+            && std::equal(std::begin(ZstdMagic), std::end(ZstdMagic), static_cast<const uint8_t*>(data));
+    }
+
+#ifdef USE_ZSTD
+    static std::vector<uint8_t> ZstdCompress(const void* data, size_t dataLen, int32_t level)
+    {
+        if (level != DefaultLevel)
+        {
+            level = std::clamp(level, 1, ZSTD_maxCLevel());
+        }
+
+        std::vector<uint8_t> output(ZSTD_compressBound(dataLen));
+        const auto ret = ZSTD_compress(output.data(), output.size(), data, dataLen, level);
+        if (ZSTD_isError(ret))
+        {
+            throw std::runtime_error(std::string("ZSTD_compress failed with error ") + ZSTD_getErrorName(ret));
+        }
+        output.resize(ret);
+        return output;
+    }
+
+    static std::vector<uint8_t> ZstdDecompress(const void* data, size_t dataLen)
+    {
+        std::vector<uint8_t> output;
+        const auto contentSize = ZSTD_getFrameContentSize(data, dataLen);
+        if (contentSize != ZSTD_CONTENTSIZE_UNKNOWN && contentSize != ZSTD_CONTENTSIZE_ERROR)
+        {
+            output.reserve(static_cast<size_t>(contentSize));
+        }
+
+        auto* dctx = ZSTD_createDCtx();
+        if (dctx == nullptr)
+        {
+            throw std::runtime_error("ZSTD_createDCtx failed");
+        }
+
+        ZSTD_inBuffer in{ data, dataLen, 0 };
+        size_t ret = 0;
+        do
+        {
+            const auto blockSize = ZSTD_DStreamOutSize();
+            output.resize(output.size() + blockSize);
+            ZSTD_outBuffer out{ output.data(), output.size(), output.size() - blockSize };
+            ret = ZSTD_decompressStream(dctx, &out, &in);
+            output.resize(out.pos);
+            if (ZSTD_isError(ret))
+            {
+                ZSTD_freeDCtx(dctx);
+                throw std::runtime_error(std::string("ZSTD_decompressStream failed with error ") + ZSTD_getErrorName(ret));
+            }
+        } while (ret != 0 && in.pos < in.size);
+        ZSTD_freeDCtx(dctx);
+
+        if (ret != 0)
+        {
+            throw std::runtime_error("Truncated zstd data");
+        }
+        return output;
+    }
+#endif
+
+    std::vector<uint8_t> Compress(CompressionType type, const void* data, size_t dataLen, int32_t level)
+    {
+        switch (type)
+        {
+            case CompressionType::None:
+            {
+                const auto* src = static_cast<const uint8_t*>(data);
+                return std::vector<uint8_t>(src, src + dataLen);
+            }
+            case CompressionType::Gzip:
+                return Gzip(data, dataLen, level == DefaultLevel ? -1 : std::clamp(level, 1, 9));
+            case CompressionType::Zstd:
+#ifdef USE_ZSTD
+                return ZstdCompress(data, dataLen, level);
+#else
+                break;
+#endif
+        }
+        throw std::runtime_error("Unsupported compression type " + std::to_string(static_cast<uint32_t>(type)));
+    }
+
+    std::vector<uint8_t> Decompress(CompressionType type, const void* data, size_t dataLen)
+    {
+        switch (type)
+        {
+            case CompressionType::None:
+            {
+                const auto* src = static_cast<const uint8_t*>(data);
+                return std::vector<uint8_t>(src, src + dataLen);
+            }
+            case CompressionType::Gzip:
+                return Ungzip(data, dataLen);
+            case CompressionType::Zstd:
+#ifdef USE_ZSTD
+                return ZstdDecompress(data, dataLen);
+#else
+                break;
+#endif
+        }
+        throw std::runtime_error("Unsupported compression type " + std::to_string(static_cast<uint32_t>(type)));
+    }
+} // namespace Compression
@@ -0,0 +1,45 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2022 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+/**
+ * Compression codecs, the values are stored in park files so must not change.
+ */
+enum class CompressionType : uint32_t
+{
+    None = 0,
+    Gzip = 1,
+    Zstd = 2,
+};
+
+namespace Compression
+{
+    // Passing this as the level uses the default level of the codec.
+    constexpr int32_t DefaultLevel = 0;
+
+    bool IsSupported(CompressionType type);
+    std::optional<CompressionType> ParseType(std::string_view name);
+    std::string_view GetTypeName(CompressionType type);
+
+    /**
+     * Returns true if the data starts with a zstd frame, used to tell zstd data apart from
+     * data written before the codec could be chosen.
+     */
+    bool IsZstdFrame(const void* data, size_t dataLen);
+
+    std::vector<uint8_t> Compress(CompressionType type, const void* data, size_t dataLen, int32_t level = DefaultLevel);
+    std::vector<uint8_t> Decompress(CompressionType type, const void* data, size_t dataLen);
+} // namespace Compression
@@ -20,9 +20,10 @@
 #include "Path.hpp"
 
 #include <chrono>
-#include <list>
+#include <optional>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 #include <vector>
 
 template<typename TItem> class FileIndex
@@ -36,18 +37,37 @@ private:
         uint32_t PathChecksum = 0;
     };
 
+    struct ScannedFile
+    {
+        std::string Path;
+        uint64_t Size = 0;
+        uint64_t LastModified = 0;
+    };
+
     struct ScanResult
     {
         DirectoryStats const Stats;
-        std::vector<std::string> const Files;
+        std::vector<ScannedFile> const Files;
 
-        ScanResult(DirectoryStats stats, std::vector<std::string> files)
+        ScanResult(DirectoryStats stats, std::vector<ScannedFile> files)
             : Stats(stats)
             , Files(files)
         {
         }
     };
 
+    /**
+     * A file as stored in the index, with the item created from it if there is one. Files are stored rather than items,
+     * so that when the directories change only added or modified files need to be indexed again.
+     */
+    struct IndexedFile
+    {
+        ScannedFile File;
+        std::optional<TItem> Item;
+    };
+
+    using IndexedFileMap = std::unordered_map<std::string, IndexedFile*>;
+
     struct FileIndexHeader
     {
         uint32_t HeaderSize = sizeof(FileIndexHeader);
@@ -56,11 +76,11 @@ private:
         uint8_t VersionB = 0;
         uint16_t LanguageId = 0;
         DirectoryStats Stats;
-        uint32_t NumItems = 0;
+        uint32_t NumFiles = 0;
     };
 
     // Index file format version which when incremented forces a rebuild
-    static constexpr uint8_t FILE_INDEX_VERSION = 4;
+    static constexpr uint8_t FILE_INDEX_VERSION = 5;
 
     std::string const _name;
     uint32_t const _magicNumber;
@@ -96,31 +116,39 @@ public:
     virtual ~FileIndex() = default;
 
     /**
-     * Queries and directories and loads the index header. If the index is up to date,
-     * the items are loaded from the index and returned, otherwise the index is rebuilt.
+     * Queries and directories and loads the index. If the index is up to date, the items are loaded from the index and
+     * returned, otherwise the index is updated by only creating the items of files that were added or modified.
      */
     std::vector<TItem> LoadOrBuild(int32_t language) const
     {
-        std::vector<TItem> items;
         auto scanResult = Scan();
-        auto readIndexResult = ReadIndexFile(language, scanResult.Stats);
-        if (std::get<0>(readIndexResult))
+        auto [upToDate, indexedFiles] = ReadIndexFile(language, scanResult.Stats);
+        if (upToDate)
         {
-            // Index was loaded
-            items = std::get<1>(readIndexResult);
+            std::vector<TItem> items;
+            items.reserve(indexedFiles.size());
+            for (auto& indexedFile : indexedFiles)
+            {
+                if (indexedFile.Item.has_value())
+                {
+                    items.push_back(std::move(*indexedFile.Item));
+                }
+            }
+            return items;
         }
-        else
+
+        IndexedFileMap previousFiles;
+        for (auto& indexedFile : indexedFiles)
         {
-            // Index was not loaded
-            items = Build(language, scanResult);
+            previousFiles.emplace(indexedFile.File.Path, &indexedFile);
         }
-        return items;
+        return Build(language, scanResult, previousFiles);
     }
 
     std::vector<TItem> Rebuild(int32_t language) const
     {
         auto scanResult = Scan();
-        auto items = Build(language, scanResult);
+        auto items = Build(language, scanResult, {});
         return items;
     }
 
@@ -140,7 +168,7 @@ private:
     ScanResult Scan() const
     {
         DirectoryStats stats{};
-        std::vector<std::string> files;
+        std::vector<ScannedFile> files;
         for (const auto& directory : SearchPaths)
         {
             auto absoluteDirectory = Path::GetAbsolute(directory);
@@ -160,20 +188,39 @@ private:
                 stats.FileDateModifiedChecksum = Numerics::ror32(stats.FileDateModifiedChecksum, 5);
                 stats.PathChecksum += GetPathChecksum(path);
 
-                files.push_back(std::move(path));
+                files.push_back({ std::move(path), fileInfo->Size, fileInfo->LastModified });
             }
         }
         return ScanResult(stats, files);
     }
 
+    /**
+     * Takes the file's entry from the previous index if the file has not changed since, otherwise returns nullptr.
+     */
+    static IndexedFile* TakeUnchangedFile(IndexedFileMap& previousFiles, const ScannedFile& file)
+    {
+        auto it = previousFiles.find(file.Path);
+        if (it == previousFiles.end())
+        {
+            return nullptr;
+        }
+
+        auto previousFile = it->second;
+        previousFiles.erase(it);
+        if (previousFile->File.Size != file.Size || previousFile->File.LastModified != file.LastModified)
+        {
+            return nullptr;
+        }
+        return previousFile;
+    }
+
     void BuildRange(
-        int32_t language, const ScanResult& scanResult, size_t rangeStart, size_t rangeEnd, std::vector<TItem>& items,
-        std::atomic<size_t>& processed, std::mutex& printLock) const
+        int32_t language, const std::vector<const ScannedFile*>& files, size_t rangeStart, size_t rangeEnd,
+        std::vector<std::optional<TItem>>& items, std::atomic<size_t>& processed, std::mutex& printLock) const
     {
-        items.reserve(rangeEnd - rangeStart);
         for (size_t i = rangeStart; i < rangeEnd; i++)
         {
-            const auto& filePath = scanResult.Files.at(i);
+            const auto& filePath = files[i]->Path;
 
             if (_log_levels[static_cast<uint8_t>(DiagnosticLevel::Verbose)])
             {
@@ -184,27 +231,55 @@ private:
             auto item = Create(language, filePath);
             if (std::get<0>(item))
             {
-                items.push_back(std::get<1>(item));
+                items[i] = std::move(std::get<1>(item));
             }
 
             processed++;
         }
     }
 
-    std::vector<TItem> Build(int32_t language, const ScanResult& scanResult) const
+    std::vector<TItem> Build(int32_t language, const ScanResult& scanResult, IndexedFileMap previousFiles) const
     {
-        std::vector<TItem> allItems;
-        Console::WriteLine("Building %s (%zu items)", _name.c_str(), scanResult.Files.size());
+        const bool incremental = !previousFiles.empty();
+
+        // Reuse the entries of unchanged files, only the others need their items to be created.
+        std::vector<IndexedFile> indexedFiles(scanResult.Files.size());
+        std::vector<const ScannedFile*> changedFiles;
+        std::vector<size_t> changedFileIndices;
+        for (size_t i = 0; i < scanResult.Files.size(); i++)
+        {
+            const auto& file = scanResult.Files[i];
+            auto previousFile = TakeUnchangedFile(previousFiles, file);
+            if (previousFile != nullptr)
+            {
+                indexedFiles[i] = std::move(*previousFile);
+            }
+            else
+            {
+                indexedFiles[i].File = file;
+                changedFiles.push_back(&file);
+                changedFileIndices.push_back(i);
+            }
+        }
+
+        const size_t totalCount = changedFiles.size();
+        if (incremental)
+        {
+            Console::WriteLine("Updating %s (%zu of %zu items changed)", _name.c_str(), totalCount, scanResult.Files.size());
+        }
+        else
+        {
+            Console::WriteLine("Building %s (%zu items)", _name.c_str(), totalCount);
+        }
 
         auto startTime = std::chrono::high_resolution_clock::now();
 
-        const size_t totalCount = scanResult.Files.size();
         if (totalCount > 0)
         {
             JobPool jobPool;
             std::mutex printLock; // For verbose prints.
 
-            std::list<std::vector<TItem>> containers;
+            std::vector<std::optional<TItem>> items(totalCount);
 
             size_t stepSize = 100; // Handpicked, seems to work well with 4/8 cores.
 
@@ -222,24 +297,32 @@ private:
                     stepSize = totalCount - rangeStart;
                 }
 
-                auto& items = containers.emplace_back();
-
                 jobPool.AddTask(std::bind(
-                    &FileIndex<TItem>::BuildRange, this, language, std::cref(scanResult), rangeStart, rangeStart + stepSize,
-                    std::ref(items), std::ref(processed), std::ref(printLock)));
+                    &FileIndex<TItem>::BuildRange, this, language, std::cref(changedFiles), rangeStart,
+                    rangeStart + stepSize, std::ref(items), std::ref(processed), std::ref(printLock)));
 
                 reportProgress();
             }
 
             jobPool.Join(reportProgress);
 
-            for (const auto& itr : containers)
+            for (size_t i = 0; i < totalCount; i++)
             {
-                allItems.insert(allItems.end(), itr.begin(), itr.end());
+                indexedFiles[changedFileIndices[i]].Item = std::move(items[i]);
             }
         }
 
-        WriteIndexFile(language, scanResult.Stats, allItems);
+        WriteIndexFile(language, scanResult.Stats, indexedFiles);
+
+        std::vector<TItem> allItems;
+        allItems.reserve(indexedFiles.size());
+        for (auto& indexedFile : indexedFiles)
+        {
+            if (indexedFile.Item.has_value())
+            {
+                allItems.push_back(std::move(*indexedFile.Item));
+            }
+        }
 
         auto endTime = std::chrono::high_resolution_clock::now();
         auto duration = std::chrono::duration<float>(endTime - startTime);
@@ -248,10 +331,14 @@ private:
         return allItems;
     }
 
-    std::tuple<bool, std::vector<TItem>> ReadIndexFile(int32_t language, const DirectoryStats& stats) const
+    /**
+     * Reads the files stored in the index. Returns whether the index is up to date, an index that is out of date still
+     * returns its files so the unchanged ones can be reused.
+     */
+    std::tuple<bool, std::vector<IndexedFile>> ReadIndexFile(int32_t language, const DirectoryStats& stats) const
     {
-        bool loadedItems = false;
-        std::vector<TItem> items;
+        bool upToDate = false;
+        std::vector<IndexedFile> indexedFiles;
         if (File::Exists(_indexPath))
         {
             try
@@ -259,24 +346,26 @@ private:
                 log_verbose("FileIndex:Loading index: '%s'", _indexPath.c_str());
                 auto fs = OpenRCT2::FileStream(_indexPath, OpenRCT2::FILE_MODE_OPEN);
 
-                // Read header, check if we need to re-scan
+                // Read header, the items can only be reused if they were created the same way
                 auto header = fs.ReadValue<FileIndexHeader>();
                 if (header.HeaderSize == sizeof(FileIndexHeader) && header.MagicNumber == _magicNumber
-                    && header.VersionA == FILE_INDEX_VERSION && header.VersionB == _version && header.LanguageId == language
-                    && header.Stats.TotalFiles == stats.TotalFiles && header.Stats.TotalFileSize == stats.TotalFileSize
-                    && header.Stats.FileDateModifiedChecksum == stats.FileDateModifiedChecksum
-                    && header.Stats.PathChecksum == stats.PathChecksum)
+                    && header.VersionA == FILE_INDEX_VERSION && header.VersionB == _version && header.LanguageId == language)
                 {
-                    items.reserve(header.NumItems);
+                    indexedFiles.resize(header.NumFiles);
                     DataSerialiser ds(false, fs);
-                    // Directory is the same, just read the saved items
-                    for (uint32_t i = 0; i < header.NumItems; i++)
+                    for (auto& indexedFile : indexedFiles)
                     {
-                        TItem item;
-                        Serialise(ds, item);
-                        items.emplace_back(std::move(item));
+                        SerialiseFile(ds, indexedFile);
+                    }
+
+                    upToDate = header.Stats.TotalFiles == stats.TotalFiles
+                        && header.Stats.TotalFileSize == stats.TotalFileSize
+                        && header.Stats.FileDateModifiedChecksum == stats.FileDateModifiedChecksum
+                        && header.Stats.PathChecksum == stats.PathChecksum;
+                    if (!upToDate)
+                    {
+                        Console::WriteLine("%s out of date", _name.c_str());
                     }
-                    loadedItems = true;
                 }
                 else
                 {
@@ -287,12 +376,13 @@ private:
             {
                 Console::Error::WriteLine("Unable to load index: '%s'.", _indexPath.c_str());
                 Console::Error::WriteLine("%s", e.what());
+                indexedFiles.clear();
             }
         }
-        return std::make_tuple(loadedItems, std::move(items));
+        return std::make_tuple(upToDate, std::move(indexedFiles));
     }
 
-    void WriteIndexFile(int32_t language, const DirectoryStats& stats, std::vector<TItem>& items) const
+    void WriteIndexFile(int32_t language, const DirectoryStats& stats, std::vector<IndexedFile>& indexedFiles) const
     {
         try
         {
@@ -307,14 +397,14 @@ private:
             header.VersionB = _version;
             header.LanguageId = language;
             header.Stats = stats;
-            header.NumItems = static_cast<uint32_t>(items.size());
+            header.NumFiles = static_cast<uint32_t>(indexedFiles.size());
             fs.WriteValue(header);
 
             DataSerialiser ds(true, fs);
-            // Write items
-            for (auto& item : items)
+            // Write files
+            for (auto& indexedFile : indexedFiles)
             {
-                Serialise(ds, item);
+                SerialiseFile(ds, indexedFile);
             }
         }
         catch (const std::exception& e)
@@ -324,6 +414,24 @@ private:
         }
     }
 
+    void SerialiseFile(DataSerialiser& ds, IndexedFile& indexedFile) const
+    {
+        ds << indexedFile.File.Path;
+        ds << indexedFile.File.Size;
+        ds << indexedFile.File.LastModified;
+
+        bool hasItem = indexedFile.Item.has_value();
+        ds << hasItem;
+        if (hasItem)
+        {
+            if (!indexedFile.Item.has_value())
+            {
+                indexedFile.Item.emplace();
+            }
+            Serialise(ds, *indexedFile.Item);
+        }
+    }
+
     static uint32_t GetPathChecksum(const std::string& path)
     {
         uint32_t hash = 0xD8430DED;
@@ -163,7 +163,9 @@ namespace Imaging
         }
     }
 
-    static void WritePng(std::ostream& ostream, const Image& image)
+    static void WritePng(
+        std::ostream& ostream, uint32_t width, uint32_t height, uint32_t depth, const GamePalette* palette,
+        const ImageRowFunc& getRow)
     {
         png_structp png_ptr = nullptr;
         png_colorp png_palette = nullptr;
@@ -186,9 +188,9 @@ namespace Imaging
                 throw std::runtime_error("png_create_info_struct failed.");
             }
 
-            if (image.Depth == 8)
+            if (depth == 8)
             {
-                if (image.Palette == nullptr)
+                if (palette == nullptr)
                 {
                     throw std::runtime_error("Expected a palette for 8-bit image.");
                 }
@@ -201,7 +203,7 @@ namespace Imaging
                 }
                 for (size_t i = 0; i < PNG_MAX_PALETTE_LENGTH; i++)
                 {
-                    const auto& entry = (*image.Palette)[static_cast<uint16_t>(i)];
+                    const auto& entry = (*palette)[static_cast<uint16_t>(i)];
                     png_palette[i].blue = entry.Blue;
                     png_palette[i].green = entry.Green;
                     png_palette[i].red = entry.Red;
@@ -219,7 +221,7 @@ namespace Imaging
 
             // Write header
             auto colourType = PNG_COLOR_TYPE_RGB_ALPHA;
-            if (image.Depth == 8)
+            if (depth == 8)
             {
                 png_byte transparentIndex = 0;
                 png_set_tRNS(png_ptr, info_ptr, &transparentIndex, 1, nullptr);
@@ -227,16 +229,14 @@ namespace Imaging
             }
             png_set_text(png_ptr, info_ptr, text_ptr, 1);
             png_set_IHDR(
-                png_ptr, info_ptr, image.Width, image.Height, 8, colourType, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT,
+                png_ptr, info_ptr, width, height, 8, colourType, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT,
                 PNG_FILTER_TYPE_DEFAULT);
             png_write_info(png_ptr, info_ptr);
 
             // Write pixels
-            auto pixels = image.Pixels.data();
-            for (uint32_t y = 0; y < image.Height; y++)
+            for (uint32_t y = 0; y < height; y++)
             {
-                png_write_row(png_ptr, const_cast<png_byte*>(pixels));
-                pixels += image.Stride;
+                png_write_row(png_ptr, const_cast<png_byte*>(getRow(y)));
             }
 
             png_write_end(png_ptr, nullptr);
@@ -252,6 +252,15 @@ namespace Imaging
         }
     }
 
+    static void WritePng(std::ostream& ostream, const Image& image)
+    {
+        const auto* pixels = image.Pixels.data();
+        const auto stride = image.Stride;
+        WritePng(ostream, image.Width, image.Height, image.Depth, image.Palette.get(), [pixels, stride](uint32_t y) {
+            return pixels + static_cast<size_t>(y) * stride;
+        });
+    }
+
     IMAGE_FORMAT GetImageFormatFromPath(std::string_view path)
     {
         if (String::EndsWith(path, ".png", true))
@@ -341,4 +350,24 @@ namespace Imaging
                 throw std::runtime_error(EXCEPTION_IMAGE_FORMAT_UNKNOWN);
         }
     }
+
+    void WriteRowsToFile(
+        std::string_view path, uint32_t width, uint32_t height, const GamePalette& palette, const ImageRowFunc& getRow,
+        IMAGE_FORMAT format)
+    {
+        switch (format)
+        {
+            case IMAGE_FORMAT::AUTOMATIC:
+                WriteRowsToFile(path, width, height, palette, getRow, GetImageFormatFromPath(path));
+                break;
+            case IMAGE_FORMAT::PNG:
+            {
+                std::ofstream fs(u8path(path), std::ios::binary);
+                WritePng(fs, width, height, 8, &palette, getRow);
+                break;
+            }
+            default:
+                throw std::runtime_error(EXCEPTION_IMAGE_FORMAT_UNKNOWN);
+        }
+    }
 } // namespace Imaging
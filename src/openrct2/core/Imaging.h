@@ -44,6 +44,12 @@ struct Image
 
 using ImageReaderFunc = std::function<Image(std::istream&, IMAGE_FORMAT)>;
 
+/**
+ * Returns the pixels of row y. Rows are requested once each, from the top, and a row only has to stay valid until the
+ * next row is requested.
+ */
+using ImageRowFunc = std::function<const uint8_t*(uint32_t y)>;
+
 namespace Imaging
 {
     IMAGE_FORMAT GetImageFormatFromPath(std::string_view path);
@@ -51,5 +57,12 @@ namespace Imaging
     Image ReadFromBuffer(const std::vector<uint8_t>& buffer, IMAGE_FORMAT format = IMAGE_FORMAT::AUTOMATIC);
     void WriteToFile(std::string_view path, const Image& image, IMAGE_FORMAT format = IMAGE_FORMAT::AUTOMATIC);
 
+    /**
+     * Writes an 8-bit image one row at a time, so the whole image never has to be held in memory.
+     */
+    void WriteRowsToFile(
+        std::string_view path, uint32_t width, uint32_t height, const GamePalette& palette, const ImageRowFunc& getRow,
+        IMAGE_FORMAT format = IMAGE_FORMAT::AUTOMATIC);
+
     void SetReader(IMAGE_FORMAT format, ImageReaderFunc impl);
 } // namespace Imaging
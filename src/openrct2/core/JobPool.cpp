@@ -9,8 +9,11 @@
 
 #include "JobPool.h"
 
+#include "../profiling/Profiling.h"
+
 #include <algorithm>
 #include <cassert>
+#include <limits>
 
 JobPool::TaskData::TaskData(std::function<void()> workFn, std::function<void()> completionFn)
     : WorkFn(workFn)
@@ -21,9 +24,10 @@ JobPool::TaskData::TaskData(std::function<void()> workFn, std::function<void()>
 JobPool::JobPool(size_t maxThreads)
 {
     maxThreads = std::min<size_t>(maxThreads, std::thread::hardware_concurrency());
+    _ranges = std::vector<WorkRange>(maxThreads + 1);
     for (size_t n = 0; n < maxThreads; n++)
     {
-        _threads.emplace_back(&JobPool::ProcessQueue, this);
+        _threads.emplace_back(&JobPool::ProcessQueue, this, n);
     }
 }
 
@@ -95,15 +99,34 @@ size_t JobPool::CountPending()
     return _pending.size();
 }
 
-void JobPool::ProcessQueue()
+void JobPool::ProcessQueue(size_t threadIndex)
 {
+    OpenRCT2::Profiling::SetThreadName("JobPool worker " + std::to_string(threadIndex));
+
+    uint32_t parallelForGeneration = 0;
     unique_lock lock(_mutex);
     do
     {
         // Wait for work or cancellation.
-        _condPending.wait(lock, [this]() { return _shouldStop || !_pending.empty(); });
+        _condPending.wait(lock, [&]() {
+            return _shouldStop || !_pending.empty() || (_parallelForActive && _parallelForGeneration != parallelForGeneration);
+        });
+
+        if (_parallelForActive && _parallelForGeneration != parallelForGeneration)
+        {
+            parallelForGeneration = _parallelForGeneration;
+            _parallelForParticipants++;
+
+            lock.unlock();
+
+            ProcessRanges(threadIndex);
 
-        if (!_pending.empty())
+            lock.lock();
+
+            _parallelForParticipants--;
+            _condComplete.notify_all();
+        }
+        else if (!_pending.empty())
         {
             _processing++;
 
@@ -123,3 +146,108 @@ void JobPool::ProcessQueue()
         }
     } while (!_shouldStop);
 }
+
+static constexpr uint64_t PackRange(uint32_t begin, uint32_t end)
+{
+    return (static_cast<uint64_t>(end) << 32) | begin;
+}
+
+static constexpr uint32_t RangeBegin(uint64_t bounds)
+{
+    return static_cast<uint32_t>(bounds);
+}
+
+static constexpr uint32_t RangeEnd(uint64_t bounds)
+{
+    return static_cast<uint32_t>(bounds >> 32);
+}
+
+void JobPool::RunParallelFor(size_t count, ParallelForFn fn, const void* context)
+{
+    if (count == 0)
+        return;
+
+    assert(count <= std::numeric_limits<uint32_t>::max());
+
+    const auto numRanges = _ranges.size();
+    {
+        unique_lock lock(_mutex);
+        if (_parallelForRunning)
+        {
+            // The ranges belong to the running ParallelFor, its threads will be busy anyway.
+            lock.unlock();
+            for (size_t i = 0; i < count; i++)
+            {
+                fn(context, i);
+            }
+            return;
+        }
+
+        // Split the indices into contiguous shares, neighbouring indices tend to cost about the same.
+        for (size_t i = 0; i < numRanges; i++)
+        {
+            const auto begin = static_cast<uint32_t>(count * i / numRanges);
+            const auto end = static_cast<uint32_t>(count * (i + 1) / numRanges);
+            _ranges[i].Bounds.store(PackRange(begin, end), std::memory_order_relaxed);
+        }
+
+        _parallelForRunning = true;
+        _parallelForFn = fn;
+        _parallelForContext = context;
+        _parallelForGeneration++;
+        _parallelForActive = true;
+        _condPending.notify_all();
+    }
+
+    ProcessRanges(numRanges - 1);
+
+    // Once the caller runs out of work nothing is left to steal, wait for the threads still running their last index.
+    unique_lock lock(_mutex);
+    _parallelForActive = false;
+    _condComplete.wait(lock, [this]() { return _parallelForParticipants == 0; });
+    _parallelForRunning = false;
+}
+
+void JobPool::ProcessRanges(size_t rangeIndex)
+{
+    const auto numRanges = _ranges.size();
+    auto& ownRange = _ranges[rangeIndex].Bounds;
+    while (true)
+    {
+        // Take indices from the front of our own range.
+        auto bounds = ownRange.load(std::memory_order_acquire);
+        while (RangeBegin(bounds) < RangeEnd(bounds))
+        {
+            const auto index = RangeBegin(bounds);
+            if (ownRange.compare_exchange_weak(
+                    bounds, PackRange(index + 1, RangeEnd(bounds)), std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                _parallelForFn(_parallelForContext, index);
+                bounds = ownRange.load(std::memory_order_acquire);
+            }
+        }
+
+        // Steal the back half of another range.
+        bool stolen = false;
+        for (size_t i = 1; i < numRanges && !stolen; i++)
+        {
+            auto& victimRange = _ranges[(rangeIndex + i) % numRanges].Bounds;
+            auto victimBounds = victimRange.load(std::memory_order_acquire);
+            while (RangeBegin(victimBounds) < RangeEnd(victimBounds))
+            {
+                const auto begin = RangeBegin(victimBounds);
+                const auto end = RangeEnd(victimBounds);
+                const auto mid = begin + (end - begin) / 2;
+                if (victimRange.compare_exchange_weak(
+                        victimBounds, PackRange(begin, mid), std::memory_order_acq_rel, std::memory_order_acquire))
+                {
+                    ownRange.store(PackRange(mid, end), std::memory_order_release);
+                    stolen = true;
+                    break;
+                }
+            }
+        }
+        if (!stolen)
+            return;
+    }
+}
@@ -11,6 +11,7 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <cstdint>
 #include <deque>
 #include <functional>
 #include <mutex>
@@ -28,6 +29,17 @@ private:
         TaskData(std::function<void()> workFn, std::function<void()> completionFn);
     };
 
+    using ParallelForFn = void (*)(const void* context, size_t index);
+
+    /**
+     * The indices [begin, end) left to a participant of ParallelFor, packed so they can be taken with a single
+     * compare and swap. The owner takes from the front, other participants steal half from the back.
+     */
+    struct alignas(64) WorkRange
+    {
+        std::atomic<uint64_t> Bounds{};
+    };
+
     std::atomic_bool _shouldStop = { false };
     std::atomic<size_t> _processing = { 0 };
     std::vector<std::thread> _threads;
@@ -37,6 +49,15 @@ private:
     std::condition_variable _condComplete;
     std::mutex _mutex;
 
+    // One range per thread plus one for the caller of ParallelFor.
+    std::vector<WorkRange> _ranges;
+    ParallelForFn _parallelForFn{};
+    const void* _parallelForContext{};
+    uint32_t _parallelForGeneration{};
+    bool _parallelForActive{};
+    bool _parallelForRunning{};
+    size_t _parallelForParticipants{};
+
     using unique_lock = std::unique_lock<std::mutex>;
 
 public:
@@ -47,6 +68,20 @@ public:
     void Join(std::function<void()> reportFn = nullptr);
     size_t CountPending();
 
+    /**
+     * Calls fn(index) for every index in [0, count) on the pool's threads and the calling thread, and returns once all
+     * calls have finished. Each thread starts on its own share of the indices and steals from the others when done,
+     * so uneven costs are balanced without allocating a task per index. fn is called through a const reference.
+     * A ParallelFor started while another one is running, such as from inside fn, runs on the calling thread alone.
+     */
+    template<typename TFn> void ParallelFor(size_t count, const TFn& fn)
+    {
+        RunParallelFor(
+            count, [](const void* context, size_t index) { (*static_cast<const TFn*>(context))(index); }, &fn);
+    }
+
 private:
-    void ProcessQueue();
+    void ProcessQueue(size_t threadIndex);
+    void RunParallelFor(size_t count, ParallelForFn fn, const void* context);
+    void ProcessRanges(size_t rangeIndex);
 };
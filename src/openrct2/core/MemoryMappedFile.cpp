@@ -0,0 +1,104 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2022 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "MemoryMappedFile.h"
+
+#include "IStream.hpp"
+#include "String.hpp"
+
+#include <string>
+
+#ifdef _WIN32
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+namespace OpenRCT2
+{
+#ifdef _WIN32
+    MemoryMappedFile::MemoryMappedFile(std::string_view path)
+    {
+        auto wPath = String::ToWideChar(path);
+        auto file = CreateFileW(
+            wPath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            throw IOException("Unable to open " + std::string(path));
+        }
+
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file, &size) || size.QuadPart == 0 || static_cast<uint64_t>(size.QuadPart) > SIZE_MAX)
+        {
+            CloseHandle(file);
+            throw IOException("Unable to map " + std::string(path));
+        }
+
+        auto mapping = CreateFileMappingW(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        auto data = mapping != nullptr ? MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0) : nullptr;
+        if (data == nullptr)
+        {
+            if (mapping != nullptr)
+            {
+                CloseHandle(mapping);
+            }
+            CloseHandle(file);
+            throw IOException("Unable to map " + std::string(path));
+        }
+
+        _file = file;
+        _mapping = mapping;
+        _data = static_cast<uint8_t*>(data);
+        _size = static_cast<size_t>(size.QuadPart);
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        UnmapViewOfFile(_data);
+        CloseHandle(_mapping);
+        CloseHandle(_file);
+    }
+#else
+    MemoryMappedFile::MemoryMappedFile(std::string_view path)
+    {
+        auto fd = open(std::string(path).c_str(), O_RDONLY);
+        if (fd == -1)
+        {
+            throw IOException("Unable to open " + std::string(path));
+        }
+
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size == 0 || static_cast<uint64_t>(st.st_size) > SIZE_MAX)
+        {
+            close(fd);
+            throw IOException("Unable to map " + std::string(path));
+        }
+
+        // The mapping stays valid after the descriptor is closed.
+        auto size = static_cast<size_t>(st.st_size);
+        auto data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (data == MAP_FAILED)
+        {
+            throw IOException("Unable to map " + std::string(path));
+        }
+
+        _data = static_cast<uint8_t*>(data);
+        _size = size;
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        munmap(_data, _size);
+    }
+#endif
+} // namespace OpenRCT2
@@ -0,0 +1,52 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2022 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+
+#include <string_view>
+
+namespace OpenRCT2
+{
+    /**
+     * A copy on write mapping of a whole file. Pages that are never written are shared with the page cache, and so with
+     * every other process mapping the same file.
+     */
+    class MemoryMappedFile final
+    {
+    private:
+        uint8_t* _data{};
+        size_t _size{};
+#ifdef _WIN32
+        void* _file{};
+        void* _mapping{};
+#endif
+
+    public:
+        /**
+         * Maps the file at the given path, throws IOException if the file cannot be mapped.
+         */
+        explicit MemoryMappedFile(std::string_view path);
+        ~MemoryMappedFile();
+
+        MemoryMappedFile(const MemoryMappedFile&) = delete;
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+        uint8_t* GetData() const
+        {
+            return _data;
+        }
+
+        size_t GetSize() const
+        {
+            return _size;
+        }
+    };
+} // namespace OpenRCT2
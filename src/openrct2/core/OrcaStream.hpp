@@ -10,6 +10,7 @@
 #pragma once
 
 #include "../world/Location.hpp"
+#include "Compression.h"
 #include "Crypt.h"
 #include "FileStream.h"
 #include "Identifier.hpp"
@@ -17,10 +18,14 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstdint>
+#include <exception>
 #include <fstream>
+#include <optional>
 #include <sstream>
 #include <stack>
+#include <thread>
 #include <type_traits>
 #include <vector>
 
@@ -37,6 +42,11 @@ namespace OpenRCT2
 
         static constexpr uint32_t COMPRESSION_NONE = 0;
         static constexpr uint32_t COMPRESSION_GZIP = 1;
+        static constexpr uint32_t COMPRESSION_ZSTD = 2;
+
+        // Each chunk is compressed independently rather than the payload as a whole. The chunk
+        // table offsets and lengths then refer to the compressed data of each chunk.
+        static constexpr uint32_t FLAG_CHUNK_COMPRESSION = 1 << 0;
 
     private:
 #pragma pack(push, 1)
@@ -50,7 +60,8 @@ namespace OpenRCT2
             uint32_t Compression{};
             uint64_t CompressedSize{};
             std::array<uint8_t, 8> FNV1a{};
-            uint8_t padding[20];
+            uint32_t Flags{};
+            uint8_t padding[16];
         };
         static_assert(sizeof(Header) == 64, "Header should be 64 bytes");
 
@@ -68,6 +79,11 @@ namespace OpenRCT2
         std::vector<ChunkEntry> _chunks;
         MemoryStream _buffer;
         ChunkEntry _currentChunk;
+        int32_t _compressionLevel = Compression::DefaultLevel;
+
+        // Chunk compression only, compressed payload and chunks that have been decompressed ahead of use.
+        std::vector<uint8_t> _compressedPayload;
+        std::vector<std::optional<std::vector<uint8_t>>> _decompressedChunks;
 
     public:
         OrcaStream(IStream& stream, const Mode mode)
@@ -85,6 +101,19 @@ namespace OpenRCT2
                     _chunks.push_back(entry);
                 }
 
+                if (_header.Flags & FLAG_CHUNK_COMPRESSION)
+                {
+                    // Chunks are decompressed on demand by SeekChunk
+                    if (_header.CompressedSize > _stream->GetLength() - _stream->GetPosition())
+                    {
+                        throw IOException("Compressed data is larger than the remaining file.");
+                    }
+                    _compressedPayload.resize(static_cast<size_t>(_header.CompressedSize));
+                    _stream->Read(_compressedPayload.data(), _compressedPayload.size());
+                    _decompressedChunks.resize(_chunks.size());
+                    return;
+                }
+
                 // Read compressed data into buffer (read in blocks)
                 _buffer = MemoryStream{};
                 uint8_t temp[2048];
@@ -98,9 +127,10 @@ namespace OpenRCT2
                 } while (bytesLeft > 0);
 
                 // Uncompress
-                if (_header.Compression == COMPRESSION_GZIP)
+                if (_header.Compression != COMPRESSION_NONE)
                 {
-                    auto uncompressedData = Ungzip(_buffer.GetData(), _buffer.GetLength());
+                    auto uncompressedData = Compression::Decompress(
+                        static_cast<CompressionType>(_header.Compression), _buffer.GetData(), _buffer.GetLength());
                     if (_header.UncompressedSize != uncompressedData.size())
                     {
                         // Warning?
@@ -113,6 +143,7 @@ namespace OpenRCT2
             {
                 _header = {};
                 _header.Compression = COMPRESSION_GZIP;
+                _header.Flags = FLAG_CHUNK_COMPRESSION;
 
                 _buffer = MemoryStream{};
             }
@@ -132,11 +163,19 @@ namespace OpenRCT2
                 _header.CompressedSize = uncompressedSize;
                 _header.FNV1a = Crypt::FNV1a(uncompressedData, uncompressedSize);
 
+                if (_header.Flags & FLAG_CHUNK_COMPRESSION)
+                {
+                    WriteCompressedChunks();
+                    return;
+                }
+
                 // Compress data
                 std::optional<std::vector<uint8_t>> compressedBytes;
-                if (_header.Compression == COMPRESSION_GZIP)
+                if (_header.Compression != COMPRESSION_NONE)
                 {
-                    compressedBytes = Gzip(uncompressedData, uncompressedSize);
+                    compressedBytes = Compression::Compress(
+                        static_cast<CompressionType>(_header.Compression), uncompressedData, uncompressedSize,
+                        _compressionLevel);
                     if (compressedBytes)
                     {
                         _header.CompressedSize = compressedBytes->size();
@@ -182,6 +221,43 @@ namespace OpenRCT2
             return _header;
         }
 
+        /**
+         * Sets the codec and level used to compress the file when writing, falls back to gzip
+         * when the codec is not supported by this build.
+         */
+        void SetCompression(CompressionType type, int32_t level = Compression::DefaultLevel)
+        {
+            if (!Compression::IsSupported(type))
+            {
+                type = CompressionType::Gzip;
+                level = Compression::DefaultLevel;
+            }
+            _header.Compression = static_cast<uint32_t>(type);
+            _compressionLevel = level;
+        }
+
+        /**
+         * Writes the file read from src to dst using the given compression. This allows a file to
+         * be serialised uncompressed and compressed later, away from the thread that serialised it.
+         */
+        static void Recompress(IStream& src, IStream& dst, CompressionType type, int32_t level = Compression::DefaultLevel)
+        {
+            OrcaStream in(src, Mode::READING);
+            OrcaStream out(dst, Mode::WRITING);
+            out.SetCompression(type, level);
+            out._header.Magic = in._header.Magic;
+            out._header.TargetVersion = in._header.TargetVersion;
+            out._header.MinVersion = in._header.MinVersion;
+            for (const auto& chunk : in._chunks)
+            {
+                in.SeekChunk(chunk.Id);
+                const auto* data = static_cast<const uint8_t*>(in._buffer.GetData()) + in._buffer.GetPosition();
+                const auto length = in._header.Flags & FLAG_CHUNK_COMPRESSION ? in._buffer.GetLength() : chunk.Length;
+                out._chunks.push_back({ chunk.Id, out._buffer.GetPosition(), length });
+                out._buffer.Write(data, static_cast<size_t>(length));
+            }
+        }
+
         template<typename TFunc> bool ReadWriteChunk(const uint32_t chunkId, TFunc f)
         {
             if (_mode == Mode::READING)
@@ -206,12 +282,65 @@ namespace OpenRCT2
             return true;
         }
 
+        /**
+         * Decompresses all chunks that have not been read yet in parallel, so that a full
+         * read of the file does not decompress chunk after chunk on the calling thread.
+         */
+        void DecompressAllChunks()
+        {
+            if (_mode != Mode::READING || !(_header.Flags & FLAG_CHUNK_COMPRESSION))
+                return;
+
+            // Exceptions can not leave a thread, so they are passed back and rethrown on the calling thread.
+            std::vector<std::exception_ptr> exceptions(_chunks.size());
+            std::vector<std::thread> threads;
+            for (size_t i = 0; i < _chunks.size(); i++)
+            {
+                if (!_decompressedChunks[i].has_value())
+                {
+                    threads.emplace_back([this, &exceptions, i]() {
+                        try
+                        {
+                            _decompressedChunks[i] = DecompressChunk(_chunks[i]);
+                        }
+                        catch (...)
+                        {
+                            exceptions[i] = std::current_exception();
+                        }
+                    });
+                }
+            }
+            for (auto& t : threads)
+            {
+                t.join();
+            }
+            for (const auto& e : exceptions)
+            {
+                if (e != nullptr)
+                {
+                    std::rethrow_exception(e);
+                }
+            }
+        }
+
     private:
         bool SeekChunk(const uint32_t id)
         {
             const auto result = std::find_if(_chunks.begin(), _chunks.end(), [id](const ChunkEntry& e) { return e.Id == id; });
             if (result != _chunks.end())
             {
+                if (_header.Flags & FLAG_CHUNK_COMPRESSION)
+                {
+                    auto& decompressed = _decompressedChunks[std::distance(_chunks.begin(), result)];
+                    const auto data = decompressed.has_value() ? std::move(*decompressed) : DecompressChunk(*result);
+                    decompressed.reset();
+
+                    _buffer.Clear();
+                    _buffer.Write(data.data(), data.size());
+                    _buffer.SetPosition(0);
+                    return true;
+                }
+
                 const auto offset = result->Offset;
                 _buffer.SetPosition(offset);
                 return true;
@@ -219,6 +348,96 @@ namespace OpenRCT2
             return false;
         }
 
+        std::vector<uint8_t> DecompressChunk(const ChunkEntry& entry) const
+        {
+            if (entry.Offset + entry.Length > _compressedPayload.size())
+            {
+                throw IOException("Chunk data is out of bounds.");
+            }
+
+            const auto* data = _compressedPayload.data() + entry.Offset;
+            const auto length = static_cast<size_t>(entry.Length);
+            if (_header.Compression != COMPRESSION_NONE && length != 0)
+            {
+                return Compression::Decompress(static_cast<CompressionType>(_header.Compression), data, length);
+            }
+            return std::vector<uint8_t>(data, data + length);
+        }
+
+        void WriteCompressedChunks()
+        {
+            const auto* uncompressedData = static_cast<const uint8_t*>(_buffer.GetData());
+
+            // Compress each chunk on its own thread, the tile and entity chunks dominate the time taken.
+            std::vector<std::optional<std::vector<uint8_t>>> compressedChunks(_chunks.size());
+            if (_header.Compression != COMPRESSION_NONE)
+            {
+                const auto type = static_cast<CompressionType>(_header.Compression);
+                std::atomic<bool> failed{ false };
+                std::vector<std::thread> threads;
+                for (size_t i = 0; i < _chunks.size(); i++)
+                {
+                    if (_chunks[i].Length == 0)
+                        continue;
+
+                    const auto* src = uncompressedData + _chunks[i].Offset;
+                    const auto len = static_cast<size_t>(_chunks[i].Length);
+                    threads.emplace_back([&compressedChunks, &failed, type, level = _compressionLevel, src, len, i]() {
+                        try
+                        {
+                            compressedChunks[i] = Compression::Compress(type, src, len, level);
+                        }
+                        catch (const std::exception&)
+                        {
+                            failed = true;
+                        }
+                    });
+                }
+                for (auto& t : threads)
+                {
+                    t.join();
+                }
+
+                if (failed)
+                {
+                    // Compression failed
+                    _header.Compression = COMPRESSION_NONE;
+                    compressedChunks.assign(_chunks.size(), std::nullopt);
+                }
+            }
+
+            // Chunk table now refers to the compressed data
+            auto chunks = _chunks;
+            uint64_t offset = 0;
+            for (size_t i = 0; i < chunks.size(); i++)
+            {
+                chunks[i].Offset = offset;
+                if (compressedChunks[i].has_value())
+                {
+                    chunks[i].Length = compressedChunks[i]->size();
+                }
+                offset += chunks[i].Length;
+            }
+            _header.CompressedSize = offset;
+
+            _stream->WriteValue(_header);
+            for (const auto& chunk : chunks)
+            {
+                _stream->WriteValue(chunk);
+            }
+            for (size_t i = 0; i < _chunks.size(); i++)
+            {
+                if (compressedChunks[i].has_value())
+                {
+                    _stream->Write(compressedChunks[i]->data(), compressedChunks[i]->size());
+                }
+                else
+                {
+                    _stream->Write(uncompressedData + _chunks[i].Offset, _chunks[i].Length);
+                }
+            }
+        }
+
     public:
         class ChunkStream
         {
@@ -0,0 +1,73 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2022 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace OpenRCT2
+{
+    /**
+     * Bounded lock-free queue for passing items from exactly one producer thread to exactly one consumer thread.
+     */
+    template<typename T> class SpscQueue
+    {
+    private:
+        std::vector<T> _items;
+        alignas(64) std::atomic<size_t> _head{};
+        alignas(64) std::atomic<size_t> _tail{};
+
+    public:
+        explicit SpscQueue(size_t capacity)
+            : _items(capacity + 1)
+        {
+        }
+
+        SpscQueue(const SpscQueue&) = delete;
+        SpscQueue& operator=(const SpscQueue&) = delete;
+
+        /**
+         * Called by the producer, returns false and leaves the item untouched if the queue is full.
+         */
+        bool TryPush(T& item)
+        {
+            const auto tail = _tail.load(std::memory_order_relaxed);
+            const auto next = Next(tail);
+            if (next == _head.load(std::memory_order_acquire))
+                return false;
+
+            _items[tail] = std::move(item);
+            _tail.store(next, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * Called by the consumer, returns false if the queue is empty.
+         */
+        bool TryPop(T& item)
+        {
+            const auto head = _head.load(std::memory_order_relaxed);
+            if (head == _tail.load(std::memory_order_acquire))
+                return false;
+
+            item = std::move(_items[head]);
+            _items[head] = T();
+            _head.store(Next(head), std::memory_order_release);
+            return true;
+        }
+
+    private:
+        size_t Next(size_t index) const
+        {
+            return index + 1 == _items.size() ? 0 : index + 1;
+        }
+    };
+} // namespace OpenRCT2
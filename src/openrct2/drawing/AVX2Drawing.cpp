@@ -9,6 +9,7 @@
 
 #include "../common.h"
 #include "../core/Guard.hpp"
+#include "../paint/Paint.h"
 #include "Drawing.h"
 
 #ifdef __AVX2__
@@ -42,6 +43,66 @@ void mask_avx2(
     }
 }
 
+void paint_sort_neighbours_avx2(
+    const PaintSortBounds& bounds, size_t begin, size_t end, const paint_struct_bound_box& initial, uint8_t rotation,
+    uint32_t* result)
+{
+    // Rotations 1 and 2 invert the x comparisons, rotations 2 and 3 the y comparisons.
+    const __m256i allSet = _mm256_set1_epi32(-1);
+    const __m256i flipX = (rotation == 1 || rotation == 2) ? allSet : _mm256_setzero_si256();
+    const __m256i flipY = (rotation == 2 || rotation == 3) ? allSet : _mm256_setzero_si256();
+    const __m256i notFlipX = _mm256_xor_si256(flipX, allSet);
+    const __m256i notFlipY = _mm256_xor_si256(flipY, allSet);
+
+    const __m256i initialX = _mm256_set1_epi32(initial.x);
+    const __m256i initialY = _mm256_set1_epi32(initial.y);
+    const __m256i initialZ = _mm256_set1_epi32(initial.z);
+    const __m256i initialXEnd = _mm256_set1_epi32(initial.x_end);
+    const __m256i initialYEnd = _mm256_set1_epi32(initial.y_end);
+    const __m256i initialZEnd = _mm256_set1_epi32(initial.z_end);
+    const __m256i neighbour = _mm256_set1_epi32(PaintSortFlags::Neighbour);
+
+    const size_t count = end - begin;
+    for (size_t word = 0; word * 32 < count; word++)
+    {
+        uint32_t bits = 0;
+        for (size_t group = 0; group < 4; group++)
+        {
+            const size_t i = begin + word * 32 + group * 8;
+            const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bounds.X.data() + i));
+            const __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bounds.Y.data() + i));
+            const __m256i z = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bounds.Z.data() + i));
+            const __m256i xEnd = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bounds.XEnd.data() + i));
+            const __m256i yEnd = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bounds.YEnd.data() + i));
+            const __m256i zEnd = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bounds.ZEnd.data() + i));
+            const __m256i sortFlags = _mm256_cvtepu8_epi32(
+                _mm_loadl_epi64(reinterpret_cast<const __m128i*>(bounds.SortFlags.data() + i)));
+
+            // initial.x_end >= x && initial.y_end >= y && initial.z_end >= z for rotation 0
+            const __m256i behind = _mm256_andnot_si256(
+                _mm256_cmpgt_epi32(z, initialZEnd),
+                _mm256_and_si256(
+                    _mm256_xor_si256(_mm256_cmpgt_epi32(x, initialXEnd), notFlipX),
+                    _mm256_xor_si256(_mm256_cmpgt_epi32(y, initialYEnd), notFlipY)));
+            // initial.x < x_end && initial.y < y_end && initial.z < z_end for rotation 0
+            const __m256i overlap = _mm256_and_si256(
+                _mm256_cmpgt_epi32(zEnd, initialZ),
+                _mm256_and_si256(
+                    _mm256_xor_si256(_mm256_cmpgt_epi32(xEnd, initialX), flipX),
+                    _mm256_xor_si256(_mm256_cmpgt_epi32(yEnd, initialY), flipY)));
+            const __m256i isNeighbour = _mm256_cmpeq_epi32(_mm256_and_si256(sortFlags, neighbour), neighbour);
+
+            const __m256i mask = _mm256_and_si256(_mm256_andnot_si256(overlap, behind), isNeighbour);
+            bits |= static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(mask))) << (group * 8);
+        }
+        result[word] = bits;
+    }
+    if (count % 32 != 0)
+    {
+        result[count / 32] &= (1U << (count % 32)) - 1;
+    }
+}
+
 #else
 
 #    ifdef OPENRCT2_X86
@@ -55,4 +116,11 @@ void mask_avx2(
     openrct2_assert(false, "AVX2 function called on a CPU that doesn't support AVX2");
 }
 
+void paint_sort_neighbours_avx2(
+    const PaintSortBounds& bounds, size_t begin, size_t end, const paint_struct_bound_box& initial, uint8_t rotation,
+    uint32_t* result)
+{
+    openrct2_assert(false, "AVX2 function called on a CPU that doesn't support AVX2");
+}
+
 #endif // __AVX2__
@@ -188,6 +188,44 @@ static bool _csgLoaded = false;
 static rct_g1_element _g1Temp = {};
 static std::vector<rct_g1_element> _imageListElements;
 bool gTinyFontAntiAliased = false;
+bool gGxUseMemoryMapping = true;
+
+/**
+ * Loads the element data that starts at the stream's position. The file is mapped when possible, so the data is only
+ * paged in when drawn and is shared by every process using the same file. Returns the address of the data.
+ */
+static uint8_t* LoadGxData(rct_gx& gx, std::string_view path, FileStream& fs)
+{
+    gx.mappedFile.reset();
+    gx.data.reset();
+    if (gGxUseMemoryMapping)
+    {
+        try
+        {
+            auto mappedFile = std::make_unique<MemoryMappedFile>(path);
+            auto dataOffset = fs.GetPosition();
+            if (dataOffset + gx.header.total_size <= mappedFile->GetSize())
+            {
+                gx.mappedFile = std::move(mappedFile);
+                return gx.mappedFile->GetData() + dataOffset;
+            }
+        }
+        catch (const std::exception& e)
+        {
+            log_verbose("%s, reading the data instead", e.what());
+        }
+    }
+    gx.data = fs.ReadArray<uint8_t>(gx.header.total_size);
+    return gx.data.get();
+}
+
+static void UnloadGx(rct_gx& gx)
+{
+    gx.elements.clear();
+    gx.elements.shrink_to_fit();
+    gx.mappedFile.reset();
+    gx.data.reset();
+}
 
 /**
  *
@@ -216,12 +254,12 @@ bool gfx_load_g1(const IPlatformEnvironment& env)
         gTinyFontAntiAliased = is_rctc;
 
         // Read element data
-        _g1.data = fs.ReadArray<uint8_t>(_g1.header.total_size);
+        auto data = LoadGxData(_g1, path, fs);
 
         // Fix entry data offsets
         for (uint32_t i = 0; i < _g1.header.num_entries; i++)
         {
-            _g1.elements[i].offset += reinterpret_cast<uintptr_t>(_g1.data.get());
+            _g1.elements[i].offset += reinterpret_cast<uintptr_t>(data);
         }
         return true;
     }
@@ -242,23 +280,17 @@ bool gfx_load_g1(const IPlatformEnvironment& env)
 
 void gfx_unload_g1()
 {
-    _g1.data.reset();
-    _g1.elements.clear();
-    _g1.elements.shrink_to_fit();
+    UnloadGx(_g1);
 }
 
 void gfx_unload_g2()
 {
-    _g2.data.reset();
-    _g2.elements.clear();
-    _g2.elements.shrink_to_fit();
+    UnloadGx(_g2);
 }
 
 void gfx_unload_csg()
 {
-    _csg.data.reset();
-    _csg.elements.clear();
-    _csg.elements.shrink_to_fit();
+    UnloadGx(_csg);
 }
 
 bool gfx_load_g2()
@@ -279,12 +311,12 @@ bool gfx_load_g2()
         read_and_convert_gxdat(&fs, _g2.header.num_entries, false, _g2.elements.data());
 
         // Read element data
-        _g2.data = fs.ReadArray<uint8_t>(_g2.header.total_size);
+        auto data = LoadGxData(_g2, path, fs);
 
         // Fix entry data offsets
         for (uint32_t i = 0; i < _g2.header.num_entries; i++)
         {
-            _g2.elements[i].offset += reinterpret_cast<uintptr_t>(_g2.data.get());
+            _g2.elements[i].offset += reinterpret_cast<uintptr_t>(data);
         }
         return true;
     }
@@ -336,12 +368,12 @@ bool gfx_load_csg()
         read_and_convert_gxdat(&fileHeader, _csg.header.num_entries, false, _csg.elements.data());
 
         // Read element data
-        _csg.data = fileData.ReadArray<uint8_t>(_csg.header.total_size);
+        auto data = LoadGxData(_csg, pathDataPath, fileData);
 
         // Fix entry data offsets
         for (uint32_t i = 0; i < _csg.header.num_entries; i++)
         {
-            _csg.elements[i].offset += reinterpret_cast<uintptr_t>(_csg.data.get());
+            _csg.elements[i].offset += reinterpret_cast<uintptr_t>(data);
             // RCT1 used zoomed offsets that counted from the beginning of the file, rather than from the current sprite.
             if (_csg.elements[i].flags & G1_FLAG_HAS_ZOOM_SPRITE)
             {
@@ -10,6 +10,7 @@
 #pragma once
 
 #include "../common.h"
+#include "../core/MemoryMappedFile.h"
 #include "../core/String.hpp"
 #include "../interface/Colour.h"
 #include "../interface/ZoomLevel.h"
@@ -100,6 +101,8 @@ struct rct_gx
 {
     rct_g1_header header;
     std::vector<rct_g1_element> elements;
+    // The element data is either mapped from the file or, if that fails, read into memory.
+    std::unique_ptr<OpenRCT2::MemoryMappedFile> mappedFile;
     std::unique_ptr<uint8_t[]> data;
 };
 
@@ -488,6 +491,7 @@ extern int32_t gPickupPeepX;
 extern int32_t gPickupPeepY;
 
 extern bool gTinyFontAntiAliased;
+extern bool gGxUseMemoryMapping;
 
 bool clip_drawpixelinfo(
     rct_drawpixelinfo* dst, rct_drawpixelinfo* src, const ScreenCoordsXY& coords, int32_t width, int32_t height);
@@ -11,15 +11,141 @@
 
 #include "../core/Imaging.h"
 
+#include <array>
+#include <atomic>
 #include <cstring>
+#include <limits>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 
 using namespace OpenRCT2::Drawing;
 using ImportResult = ImageImporter::ImportResult;
 
 constexpr int32_t PALETTE_TRANSPARENT = -1;
 
+/**
+ * Matches colours to a palette without searching the whole palette for every pixel. Exact matches are looked up by
+ * colour, and the closest entry of each colour is cached in a cube that is filled in as colours are seen, which is
+ * shared by every import.
+ */
+class ImageImporter::PaletteLookup
+{
+private:
+    static constexpr size_t ColourCount = 1 << 24;
+
+    std::unordered_map<uint32_t, uint8_t> _indices;
+
+    // The entries pixels can be changed to, kept in separate channels so the distances are computed in vectors.
+    size_t _count{};
+    std::array<int32_t, PALETTE_SIZE> _red{};
+    std::array<int32_t, PALETTE_SIZE> _green{};
+    std::array<int32_t, PALETTE_SIZE> _blue{};
+    std::array<uint8_t, PALETTE_SIZE> _entries{};
+
+    // Closest entry of every colour, 0 until it has been searched for as index 0 can never be the closest.
+    std::unique_ptr<std::atomic<uint8_t>[]> _closest;
+    std::once_flag _closestAllocated;
+
+public:
+    explicit PaletteLookup(const GamePalette& palette)
+    {
+        for (int32_t i = 0; i < PALETTE_SIZE; i++)
+        {
+            // Keep the first index of colours that appear more than once
+            _indices.emplace(GetKey(palette[i].Red, palette[i].Green, palette[i].Blue), static_cast<uint8_t>(i));
+            if (IsChangablePixel(i))
+            {
+                _red[_count] = palette[i].Red;
+                _green[_count] = palette[i].Green;
+                _blue[_count] = palette[i].Blue;
+                _entries[_count] = static_cast<uint8_t>(i);
+                _count++;
+            }
+        }
+    }
+
+    int32_t GetIndex(const int16_t* colour) const
+    {
+        if (IsInRange(colour))
+        {
+            auto it = _indices.find(GetKey(colour[0], colour[1], colour[2]));
+            if (it != _indices.end())
+            {
+                return it->second;
+            }
+        }
+        return PALETTE_TRANSPARENT;
+    }
+
+    int32_t GetClosestIndex(const int16_t* colour)
+    {
+        // Dithering can push colours out of range, those are rare enough to always search for
+        if (!IsInRange(colour))
+        {
+            return FindClosestIndex(colour);
+        }
+
+        std::call_once(_closestAllocated, [this] { _closest = std::make_unique<std::atomic<uint8_t>[]>(ColourCount); });
+        auto& closest = _closest[GetKey(colour[0], colour[1], colour[2])];
+        auto index = closest.load(std::memory_order_relaxed);
+        if (index == 0)
+        {
+            auto result = FindClosestIndex(colour);
+            if (result == PALETTE_TRANSPARENT)
+            {
+                return result;
+            }
+            index = static_cast<uint8_t>(result);
+            closest.store(index, std::memory_order_relaxed);
+        }
+        return index;
+    }
+
+private:
+    static uint32_t GetKey(int32_t red, int32_t green, int32_t blue)
+    {
+        return (static_cast<uint32_t>(red) << 16) | (static_cast<uint32_t>(green) << 8) | static_cast<uint32_t>(blue);
+    }
+
+    static bool IsInRange(const int16_t* colour)
+    {
+        return colour[0] >= 0 && colour[0] <= 255 && colour[1] >= 0 && colour[1] <= 255 && colour[2] >= 0
+            && colour[2] <= 255;
+    }
+
+    int32_t FindClosestIndex(const int16_t* colour) const
+    {
+        // Compute every distance first, the loop has no dependencies between entries so it is vectorised.
+        std::array<int32_t, PALETTE_SIZE> errors;
+        const int32_t red = colour[0];
+        const int32_t green = colour[1];
+        const int32_t blue = colour[2];
+        for (size_t i = 0; i < _count; i++)
+        {
+            const int32_t dr = _red[i] - red;
+            const int32_t dg = _green[i] - green;
+            const int32_t db = _blue[i] - blue;
+            errors[i] = dr * dr + dg * dg + db * db;
+        }
+
+        // The first of equally close entries wins
+        auto bestMatch = PALETTE_TRANSPARENT;
+        auto smallestError = std::numeric_limits<int32_t>::max();
+        for (size_t i = 0; i < _count; i++)
+        {
+            if (errors[i] < smallestError)
+            {
+                bestMatch = _entries[i];
+                smallestError = errors[i];
+            }
+        }
+        return bestMatch;
+    }
+};
+
 ImportResult ImageImporter::Import(
     const Image& image, int32_t offsetX, int32_t offsetY, Palette palette, ImportFlags flags, ImportMode mode) const
 {
@@ -234,11 +360,12 @@ std::vector<uint8_t> ImageImporter::EncodeRLE(const int32_t* pixels, uint32_t wi
 int32_t ImageImporter::CalculatePaletteIndex(
     ImportMode mode, int16_t* rgbaSrc, int32_t x, int32_t y, int32_t width, int32_t height)
 {
+    static PaletteLookup lookup(StandardPalette);
     auto& palette = StandardPalette;
-    auto paletteIndex = GetPaletteIndex(palette, rgbaSrc);
-    if ((mode == ImportMode::Closest || mode == ImportMode::Dithering) && !IsInPalette(palette, rgbaSrc))
+    auto paletteIndex = GetPaletteIndex(lookup, rgbaSrc);
+    if ((mode == ImportMode::Closest || mode == ImportMode::Dithering) && !IsInPalette(lookup, rgbaSrc))
     {
-        paletteIndex = GetClosestPaletteIndex(palette, rgbaSrc);
+        paletteIndex = GetClosestPaletteIndex(lookup, rgbaSrc);
         if (mode == ImportMode::Dithering)
         {
             auto dr = rgbaSrc[0] - static_cast<int16_t>(palette[paletteIndex].Red);
@@ -250,8 +377,8 @@ int32_t ImageImporter::CalculatePaletteIndex(
 
             if (x + 1 < width)
             {
-                if (!IsInPalette(palette, rgbaSrc + 4)
-                    && thisIndexType == GetPaletteIndexType(GetClosestPaletteIndex(palette, rgbaSrc + 4)))
+                if (!IsInPalette(lookup, rgbaSrc + 4)
+                    && thisIndexType == GetPaletteIndexType(GetClosestPaletteIndex(lookup, rgbaSrc + 4)))
                 {
                     // Right
                     rgbaSrc[4] += dr * 7 / 16;
@@ -264,8 +391,8 @@ int32_t ImageImporter::CalculatePaletteIndex(
             {
                 if (x > 0)
                 {
-                    if (!IsInPalette(palette, rgbaSrc + 4 * (width - 1))
-                        && thisIndexType == GetPaletteIndexType(GetClosestPaletteIndex(palette, rgbaSrc + 4 * (width - 1))))
+                    if (!IsInPalette(lookup, rgbaSrc + 4 * (width - 1))
+                        && thisIndexType == GetPaletteIndexType(GetClosestPaletteIndex(lookup, rgbaSrc + 4 * (width - 1))))
                     {
                         // Bottom left
                         rgbaSrc[4 * (width - 1)] += dr * 3 / 16;
@@ -275,8 +402,8 @@ int32_t ImageImporter::CalculatePaletteIndex(
                 }
 
                 // Bottom
-                if (!IsInPalette(palette, rgbaSrc + 4 * width)
-                    && thisIndexType == GetPaletteIndexType(GetClosestPaletteIndex(palette, rgbaSrc + 4 * width)))
+                if (!IsInPalette(lookup, rgbaSrc + 4 * width)
+                    && thisIndexType == GetPaletteIndexType(GetClosestPaletteIndex(lookup, rgbaSrc + 4 * width)))
                 {
                     rgbaSrc[4 * width] += dr * 5 / 16;
                     rgbaSrc[4 * width + 1] += dg * 5 / 16;
@@ -285,8 +412,8 @@ int32_t ImageImporter::CalculatePaletteIndex(
 
                 if (x + 1 < width)
                 {
-                    if (!IsInPalette(palette, rgbaSrc + 4 * (width + 1))
-                        && thisIndexType == GetPaletteIndexType(GetClosestPaletteIndex(palette, rgbaSrc + 4 * (width + 1))))
+                    if (!IsInPalette(lookup, rgbaSrc + 4 * (width + 1))
+                        && thisIndexType == GetPaletteIndexType(GetClosestPaletteIndex(lookup, rgbaSrc + 4 * (width + 1))))
                     {
                         // Bottom right
                         rgbaSrc[4 * (width + 1)] += dr * 1 / 16;
@@ -301,18 +428,11 @@ int32_t ImageImporter::CalculatePaletteIndex(
     return paletteIndex;
 }
 
-int32_t ImageImporter::GetPaletteIndex(const GamePalette& palette, int16_t* colour)
+int32_t ImageImporter::GetPaletteIndex(const PaletteLookup& lookup, int16_t* colour)
 {
     if (!IsTransparentPixel(colour))
     {
-        for (int32_t i = 0; i < PALETTE_SIZE; i++)
-        {
-            if (static_cast<int16_t>(palette[i].Red) == colour[0] && static_cast<int16_t>(palette[i].Green) == colour[1]
-                && static_cast<int16_t>(palette[i].Blue) == colour[2])
-            {
-                return i;
-            }
-        }
+        return lookup.GetIndex(colour);
     }
     return PALETTE_TRANSPARENT;
 }
@@ -325,9 +445,9 @@ bool ImageImporter::IsTransparentPixel(const int16_t* colour)
 /**
  * @returns true if this colour is in the standard palette.
  */
-bool ImageImporter::IsInPalette(const GamePalette& palette, int16_t* colour)
+bool ImageImporter::IsInPalette(const PaletteLookup& lookup, int16_t* colour)
 {
-    return !(GetPaletteIndex(palette, colour) == PALETTE_TRANSPARENT && !IsTransparentPixel(colour));
+    return !(GetPaletteIndex(lookup, colour) == PALETTE_TRANSPARENT && !IsTransparentPixel(colour));
 }
 
 /**
@@ -359,25 +479,7 @@ ImageImporter::PaletteIndexType ImageImporter::GetPaletteIndexType(int32_t palet
     return PaletteIndexType::Normal;
 }
 
-int32_t ImageImporter::GetClosestPaletteIndex(const GamePalette& palette, const int16_t* colour)
+int32_t ImageImporter::GetClosestPaletteIndex(PaletteLookup& lookup, const int16_t* colour)
 {
-    auto smallestError = static_cast<uint32_t>(-1);
-    auto bestMatch = PALETTE_TRANSPARENT;
-    for (int32_t x = 0; x < PALETTE_SIZE; x++)
-    {
-        if (IsChangablePixel(x))
-        {
-            uint32_t error = (static_cast<int16_t>(palette[x].Red) - colour[0])
-                    * (static_cast<int16_t>(palette[x].Red) - colour[0])
-                + (static_cast<int16_t>(palette[x].Green) - colour[1]) * (static_cast<int16_t>(palette[x].Green) - colour[1])
-                + (static_cast<int16_t>(palette[x].Blue) - colour[2]) * (static_cast<int16_t>(palette[x].Blue) - colour[2]);
-
-            if (smallestError == static_cast<uint32_t>(-1) || smallestError > error)
-            {
-                bestMatch = x;
-                smallestError = error;
-            }
-        }
-    }
-    return bestMatch;
+    return lookup.GetClosestIndex(colour);
 }
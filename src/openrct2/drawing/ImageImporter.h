@@ -68,6 +68,8 @@ namespace OpenRCT2::Drawing
             Special,
         };
 
+        class PaletteLookup;
+
         static std::vector<int32_t> GetPixels(
             const uint8_t* pixels, uint32_t pitch, uint32_t srcX, uint32_t srcY, uint32_t width, uint32_t height,
             Palette palette, ImportFlags flags, ImportMode mode);
@@ -76,12 +78,12 @@ namespace OpenRCT2::Drawing
 
         static int32_t CalculatePaletteIndex(
             ImportMode mode, int16_t* rgbaSrc, int32_t x, int32_t y, int32_t width, int32_t height);
-        static int32_t GetPaletteIndex(const GamePalette& palette, int16_t* colour);
+        static int32_t GetPaletteIndex(const PaletteLookup& lookup, int16_t* colour);
         static bool IsTransparentPixel(const int16_t* colour);
-        static bool IsInPalette(const GamePalette& palette, int16_t* colour);
+        static bool IsInPalette(const PaletteLookup& lookup, int16_t* colour);
         static bool IsChangablePixel(int32_t paletteIndex);
         static PaletteIndexType GetPaletteIndexType(int32_t paletteIndex);
-        static int32_t GetClosestPaletteIndex(const GamePalette& palette, const int16_t* colour);
+        static int32_t GetClosestPaletteIndex(PaletteLookup& lookup, const int16_t* colour);
     };
 } // namespace OpenRCT2::Drawing
 
@@ -694,6 +694,11 @@ uint32_t lightfx_get_light_polution()
     return _lightPolution_front;
 }
 
+uint32_t lightfx_get_light_count()
+{
+    return LightListCurrentCountBack;
+}
+
 void lightfx_add_lights_magic_vehicle(const Vehicle* vehicle)
 {
     static constexpr const int16_t offsetLookup[] = {
@@ -72,6 +72,9 @@ void LightFxAddShopLights(const CoordsXY& mapPosition, const uint8_t direction,
 
 uint32_t lightfx_get_light_polution();
 
+// The number of lights added since the buffers were last swapped.
+uint32_t lightfx_get_light_count();
+
 void lightfx_apply_palette_filter(uint8_t i, uint8_t* r, uint8_t* g, uint8_t* b);
 void lightfx_render_to_texture(
     void* dstPixels, uint32_t dstPitch, uint8_t* bits, uint32_t width, uint32_t height, const uint32_t* palette,
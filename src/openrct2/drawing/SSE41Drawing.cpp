@@ -9,10 +9,12 @@
 
 #include "../common.h"
 #include "../core/Guard.hpp"
+#include "../paint/Paint.h"
 #include "Drawing.h"
 
 #ifdef __SSE4_1__
 
+#    include <cstring>
 #    include <immintrin.h>
 
 void mask_sse4_1(
@@ -56,6 +58,68 @@ void mask_sse4_1(
     }
 }
 
+void paint_sort_neighbours_sse4_1(
+    const PaintSortBounds& bounds, size_t begin, size_t end, const paint_struct_bound_box& initial, uint8_t rotation,
+    uint32_t* result)
+{
+    // Rotations 1 and 2 invert the x comparisons, rotations 2 and 3 the y comparisons.
+    const __m128i allSet = _mm_set1_epi32(-1);
+    const __m128i flipX = (rotation == 1 || rotation == 2) ? allSet : _mm_setzero_si128();
+    const __m128i flipY = (rotation == 2 || rotation == 3) ? allSet : _mm_setzero_si128();
+    const __m128i notFlipX = _mm_xor_si128(flipX, allSet);
+    const __m128i notFlipY = _mm_xor_si128(flipY, allSet);
+
+    const __m128i initialX = _mm_set1_epi32(initial.x);
+    const __m128i initialY = _mm_set1_epi32(initial.y);
+    const __m128i initialZ = _mm_set1_epi32(initial.z);
+    const __m128i initialXEnd = _mm_set1_epi32(initial.x_end);
+    const __m128i initialYEnd = _mm_set1_epi32(initial.y_end);
+    const __m128i initialZEnd = _mm_set1_epi32(initial.z_end);
+    const __m128i neighbour = _mm_set1_epi32(PaintSortFlags::Neighbour);
+
+    const size_t count = end - begin;
+    for (size_t word = 0; word * 32 < count; word++)
+    {
+        uint32_t bits = 0;
+        for (size_t group = 0; group < 8; group++)
+        {
+            const size_t i = begin + word * 32 + group * 4;
+            const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bounds.X.data() + i));
+            const __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bounds.Y.data() + i));
+            const __m128i z = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bounds.Z.data() + i));
+            const __m128i xEnd = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bounds.XEnd.data() + i));
+            const __m128i yEnd = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bounds.YEnd.data() + i));
+            const __m128i zEnd = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bounds.ZEnd.data() + i));
+            int32_t flags;
+            std::memcpy(&flags, bounds.SortFlags.data() + i, sizeof(flags));
+            // _mm_cvtepu8_epi32 is SSE4.1
+            const __m128i sortFlags = _mm_cvtepu8_epi32(_mm_cvtsi32_si128(flags));
+
+            // initial.x_end >= x && initial.y_end >= y && initial.z_end >= z for rotation 0
+            const __m128i behind = _mm_andnot_si128(
+                _mm_cmpgt_epi32(z, initialZEnd),
+                _mm_and_si128(
+                    _mm_xor_si128(_mm_cmpgt_epi32(x, initialXEnd), notFlipX),
+                    _mm_xor_si128(_mm_cmpgt_epi32(y, initialYEnd), notFlipY)));
+            // initial.x < x_end && initial.y < y_end && initial.z < z_end for rotation 0
+            const __m128i overlap = _mm_and_si128(
+                _mm_cmpgt_epi32(zEnd, initialZ),
+                _mm_and_si128(
+                    _mm_xor_si128(_mm_cmpgt_epi32(xEnd, initialX), flipX),
+                    _mm_xor_si128(_mm_cmpgt_epi32(yEnd, initialY), flipY)));
+            const __m128i isNeighbour = _mm_cmpeq_epi32(_mm_and_si128(sortFlags, neighbour), neighbour);
+
+            const __m128i mask = _mm_and_si128(_mm_andnot_si128(overlap, behind), isNeighbour);
+            bits |= static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(mask))) << (group * 4);
+        }
+        result[word] = bits;
+    }
+    if (count % 32 != 0)
+    {
+        result[count / 32] &= (1U << (count % 32)) - 1;
+    }
+}
+
 #else
 
 #    ifdef OPENRCT2_X86
@@ -69,4 +133,11 @@ void mask_sse4_1(
     openrct2_assert(false, "SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
 }
 
+void paint_sort_neighbours_sse4_1(
+    const PaintSortBounds& bounds, size_t begin, size_t end, const paint_struct_bound_box& initial, uint8_t rotation,
+    uint32_t* result)
+{
+    openrct2_assert(false, "SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
+}
+
 #endif // __SSE4_1__
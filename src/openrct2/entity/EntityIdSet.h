@@ -0,0 +1,201 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2022 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../Identifiers.h"
+#include "../util/Util.h"
+#include "EntityRegistry.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+/**
+ * Ordered set of entity ids backed by a two level bitmap. Iteration is always in
+ * sprite_index order which is required to keep the game state deterministic.
+ * Insertion and removal are O(1) and do not invalidate iterators, ids inserted past
+ * the iterator's position during iteration will be visited.
+ */
+class EntityIdSet
+{
+public:
+    using UnderlyingType = EntityId::UnderlyingType;
+    static constexpr size_t Capacity = MAX_ENTITIES;
+
+private:
+    static constexpr size_t BitsPerWord = 64;
+    static constexpr size_t NumWords = (Capacity + BitsPerWord - 1) / BitsPerWord;
+    static constexpr size_t NumSummaryWords = (NumWords + BitsPerWord - 1) / BitsPerWord;
+
+    // Bit N of _summary is set when _words[N] has any bit set.
+    std::array<uint64_t, NumWords> _words{};
+    std::array<uint64_t, NumSummaryWords> _summary{};
+    size_t _count{};
+
+    static constexpr uint64_t BitMask(size_t index)
+    {
+        return 1ULL << (index % BitsPerWord);
+    }
+
+    static size_t LowestBit(uint64_t bits)
+    {
+        return static_cast<size_t>(bitscanforward(static_cast<int64_t>(bits)));
+    }
+
+public:
+    class const_iterator
+    {
+    private:
+        const EntityIdSet* _set{};
+        size_t _index{};
+
+    public:
+        const_iterator(const EntityIdSet* set, size_t index)
+            : _set(set)
+            , _index(index)
+        {
+        }
+        const_iterator& operator++()
+        {
+            _index = _set->FindNext(_index + 1);
+            return *this;
+        }
+        const_iterator operator++(int)
+        {
+            const_iterator retval = *this;
+            ++(*this);
+            return retval;
+        }
+        bool operator==(const const_iterator& other) const
+        {
+            return _index == other._index;
+        }
+        bool operator!=(const const_iterator& other) const
+        {
+            return !(*this == other);
+        }
+        EntityId operator*() const
+        {
+            return EntityId::FromUnderlying(static_cast<UnderlyingType>(_index));
+        }
+        // iterator traits
+        using difference_type = std::ptrdiff_t;
+        using value_type = EntityId;
+        using pointer = const EntityId*;
+        using reference = const EntityId&;
+        using iterator_category = std::forward_iterator_tag;
+    };
+
+    bool insert(EntityId id)
+    {
+        const auto index = static_cast<size_t>(id.ToUnderlying());
+        if (index >= Capacity)
+            return false;
+
+        auto& word = _words[index / BitsPerWord];
+        const auto mask = BitMask(index);
+        if ((word & mask) != 0)
+            return false;
+
+        word |= mask;
+        _summary[index / BitsPerWord / BitsPerWord] |= BitMask(index / BitsPerWord);
+        _count++;
+        return true;
+    }
+
+    bool erase(EntityId id)
+    {
+        const auto index = static_cast<size_t>(id.ToUnderlying());
+        if (index >= Capacity)
+            return false;
+
+        const auto wordIndex = index / BitsPerWord;
+        auto& word = _words[wordIndex];
+        const auto mask = BitMask(index);
+        if ((word & mask) == 0)
+            return false;
+
+        word &= ~mask;
+        if (word == 0)
+        {
+            _summary[wordIndex / BitsPerWord] &= ~BitMask(wordIndex);
+        }
+        _count--;
+        return true;
+    }
+
+    bool contains(EntityId id) const
+    {
+        const auto index = static_cast<size_t>(id.ToUnderlying());
+        if (index >= Capacity)
+            return false;
+        return (_words[index / BitsPerWord] & BitMask(index)) != 0;
+    }
+
+    void clear()
+    {
+        _words.fill(0);
+        _summary.fill(0);
+        _count = 0;
+    }
+
+    size_t size() const
+    {
+        return _count;
+    }
+
+    bool empty() const
+    {
+        return _count == 0;
+    }
+
+    /**
+     * Returns the lowest index in the set that is greater or equal to start, or Capacity
+     * when there is none.
+     */
+    size_t FindNext(size_t start) const
+    {
+        if (start >= Capacity)
+            return Capacity;
+
+        auto wordIndex = start / BitsPerWord;
+        const auto bits = _words[wordIndex] & (~0ULL << (start % BitsPerWord));
+        if (bits != 0)
+            return wordIndex * BitsPerWord + LowestBit(bits);
+
+        // Use the summary to skip over empty words.
+        wordIndex++;
+        if (wordIndex >= NumWords)
+            return Capacity;
+
+        auto summaryIndex = wordIndex / BitsPerWord;
+        auto summaryBits = _summary[summaryIndex] & (~0ULL << (wordIndex % BitsPerWord));
+        while (summaryBits == 0)
+        {
+            summaryIndex++;
+            if (summaryIndex >= NumSummaryWords)
+                return Capacity;
+            summaryBits = _summary[summaryIndex];
+        }
+
+        wordIndex = summaryIndex * BitsPerWord + LowestBit(summaryBits);
+        return wordIndex * BitsPerWord + LowestBit(_words[wordIndex]);
+    }
+
+    const_iterator begin() const
+    {
+        return const_iterator(this, FindNext(0));
+    }
+    const_iterator end() const
+    {
+        return const_iterator(this, Capacity);
+    }
+};
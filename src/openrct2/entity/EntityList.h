@@ -13,18 +13,31 @@
 #include "../rct12/RCT12.h"
 #include "../world/Location.hpp"
 #include "EntityBase.h"
+#include "EntityIdSet.h"
 #include "EntityRegistry.h"
 
-#include <list>
 #include <vector>
 
-const std::list<EntityId>& GetEntityList(const EntityType id);
+const EntityIdSet& GetEntityList(const EntityType id);
 
 uint16_t GetEntityListCount(EntityType list);
 uint16_t GetMiscEntityCount();
 uint16_t GetNumFreeEntities();
 const std::vector<EntityId>& GetEntityTileList(const CoordsXY& spritePos);
 
+struct Litter;
+
+/**
+ * Returns the litter whose location is within the inclusive range, in sprite_index order.
+ */
+std::vector<Litter*> GetLitterInRange(const MapRange& range);
+
+/**
+ * Gets a box that contains the location of every litter entity, the box may be larger than needed.
+ * Returns false when there is litter that is not on the map.
+ */
+bool GetLitterBounds(CoordsXYZ& min, CoordsXYZ& max);
+
 template<typename T> class EntityTileIterator
 {
 private:
@@ -100,12 +113,12 @@ public:
 template<typename T> class EntityListIterator
 {
 private:
-    std::list<EntityId>::const_iterator iter;
-    std::list<EntityId>::const_iterator end;
+    EntityIdSet::const_iterator iter;
+    EntityIdSet::const_iterator end;
     T* Entity = nullptr;
 
 public:
-    EntityListIterator(std::list<EntityId>::const_iterator _iter, std::list<EntityId>::const_iterator _end)
+    EntityListIterator(EntityIdSet::const_iterator _iter, EntityIdSet::const_iterator _end)
         : iter(_iter)
         , end(_end)
     {
@@ -152,7 +165,7 @@ template<typename T = EntityBase> class EntityList
 {
 private:
     using EntityListIterator_t = EntityListIterator<T>;
-    const std::list<EntityId>& vec;
+    const EntityIdSet& vec;
 
 public:
     EntityList()
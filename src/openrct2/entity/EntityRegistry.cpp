@@ -25,14 +25,18 @@
 #include "../scenario/Scenario.h"
 #include "Balloon.h"
 #include "Duck.h"
+#include "EntityList.h"
 #include "EntityTweener.h"
 #include "Fountain.h"
+#include "Litter.h"
 #include "MoneyEffect.h"
 #include "Particle.h"
 
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <iterator>
+#include <memory>
 #include <numeric>
 #include <vector>
 
@@ -47,7 +51,7 @@ union Entity
 };
 
 static Entity _entities[MAX_ENTITIES]{};
-static std::array<std::list<EntityId>, EnumValue(EntityType::Count)> gEntityLists;
+static std::array<EntityIdSet, EnumValue(EntityType::Count)> gEntityLists;
 static std::vector<EntityId> _freeIdList;
 
 static bool _entityFlashingList[MAX_ENTITIES];
@@ -57,6 +61,21 @@ constexpr const uint32_t SPATIAL_INDEX_LOCATION_NULL = SPATIAL_INDEX_SIZE - 1;
 
 static std::array<std::vector<EntityId>, SPATIAL_INDEX_SIZE> gEntitySpatialIndex;
 
+// Litter is also indexed by blocks of tiles so that handymen and guests do not have to visit all litter to find the
+// litter close to them. The last entry holds litter that is not on the map.
+constexpr const int32_t LITTER_INDEX_BLOCK_SIZE = 8;
+constexpr const int32_t LITTER_INDEX_BLOCKS_PER_SIDE = (MAXIMUM_MAP_SIZE_TECHNICAL + LITTER_INDEX_BLOCK_SIZE - 1)
+    / LITTER_INDEX_BLOCK_SIZE;
+constexpr const uint32_t LITTER_INDEX_SIZE = (LITTER_INDEX_BLOCKS_PER_SIDE * LITTER_INDEX_BLOCKS_PER_SIDE) + 1;
+constexpr const uint32_t LITTER_INDEX_LOCATION_NULL = LITTER_INDEX_SIZE - 1;
+
+static std::array<std::vector<EntityId>, LITTER_INDEX_SIZE> _litterIndex;
+
+// Box containing all litter on the map, only grows until the spatial indices are reset.
+static CoordsXYZ _litterBoundsMin;
+static CoordsXYZ _litterBoundsMax;
+static bool _litterBoundsEmpty = true;
+
 static void FreeEntity(EntityBase& entity);
 
 static constexpr size_t GetSpatialIndexOffset(const CoordsXY& loc)
@@ -139,6 +158,79 @@ const std::vector<EntityId>& GetEntityTileList(const CoordsXY& spritePos)
     return gEntitySpatialIndex[GetSpatialIndexOffset(spritePos)];
 }
 
+static size_t GetLitterIndexOffset(size_t spatialIndexOffset)
+{
+    if (spatialIndexOffset == SPATIAL_INDEX_LOCATION_NULL)
+        return LITTER_INDEX_LOCATION_NULL;
+
+    const auto tileX = static_cast<int32_t>(spatialIndexOffset / MAXIMUM_MAP_SIZE_TECHNICAL);
+    const auto tileY = static_cast<int32_t>(spatialIndexOffset % MAXIMUM_MAP_SIZE_TECHNICAL);
+    return (tileX / LITTER_INDEX_BLOCK_SIZE) * LITTER_INDEX_BLOCKS_PER_SIDE + (tileY / LITTER_INDEX_BLOCK_SIZE);
+}
+
+static void ExtendLitterBounds(const CoordsXYZ& loc)
+{
+    if (loc.x == LOCATION_NULL)
+        return;
+
+    if (_litterBoundsEmpty)
+    {
+        _litterBoundsMin = loc;
+        _litterBoundsMax = loc;
+        _litterBoundsEmpty = false;
+        return;
+    }
+    _litterBoundsMin = { std::min(_litterBoundsMin.x, loc.x), std::min(_litterBoundsMin.y, loc.y),
+                         std::min(_litterBoundsMin.z, loc.z) };
+    _litterBoundsMax = { std::max(_litterBoundsMax.x, loc.x), std::max(_litterBoundsMax.y, loc.y),
+                         std::max(_litterBoundsMax.z, loc.z) };
+}
+
+std::vector<Litter*> GetLitterInRange(const MapRange& range)
+{
+    std::vector<Litter*> result;
+    const auto left = std::max(range.GetLeft(), 0);
+    const auto top = std::max(range.GetTop(), 0);
+    const auto right = std::min(range.GetRight(), MAXIMUM_MAP_SIZE_BIG - 1);
+    const auto bottom = std::min(range.GetBottom(), MAXIMUM_MAP_SIZE_BIG - 1);
+    if (left > right || top > bottom)
+        return result;
+
+    constexpr auto blockSize = LITTER_INDEX_BLOCK_SIZE * COORDS_XY_STEP;
+    for (auto blockX = left / blockSize; blockX <= right / blockSize; blockX++)
+    {
+        for (auto blockY = top / blockSize; blockY <= bottom / blockSize; blockY++)
+        {
+            for (auto id : _litterIndex[blockX * LITTER_INDEX_BLOCKS_PER_SIDE + blockY])
+            {
+                auto* litter = GetEntity<Litter>(id);
+                if (litter != nullptr && litter->x >= left && litter->x <= right && litter->y >= top
+                    && litter->y <= bottom)
+                {
+                    result.push_back(litter);
+                }
+            }
+        }
+    }
+
+    // Callers rely on the same order as EntityList<Litter> for tie breaking.
+    std::sort(
+        result.begin(), result.end(), [](const Litter* a, const Litter* b) { return a->sprite_index < b->sprite_index; });
+    return result;
+}
+
+bool GetLitterBounds(CoordsXYZ& min, CoordsXYZ& max)
+{
+    min = _litterBoundsMin;
+    max = _litterBoundsMax;
+    if (_litterBoundsEmpty)
+    {
+        min = {};
+        max = {};
+    }
+    return _litterIndex[LITTER_INDEX_LOCATION_NULL].empty();
+}
+
 static void ResetEntityLists()
 {
     for (auto& list : gEntityLists)
@@ -160,7 +252,7 @@ static void ResetFreeIds()
     });
 }
 
-const std::list<EntityId>& GetEntityList(const EntityType id)
+const EntityIdSet& GetEntityList(const EntityType id)
 {
     return gEntityLists[EnumValue(id)];
 }
@@ -218,18 +310,28 @@ void ResetEntitySpatialIndices()
     {
         vec.clear();
     }
+    for (auto& vec : _litterIndex)
+    {
+        vec.clear();
+    }
+    _litterBoundsEmpty = true;
     for (EntityId::UnderlyingType i = 0; i < MAX_ENTITIES; i++)
     {
         auto* spr = GetEntity(EntityId::FromUnderlying(i));
         if (spr != nullptr && spr->Type != EntityType::Null)
         {
             EntitySpatialInsert(spr, { spr->x, spr->y });
+            if (spr->Type == EntityType::Litter)
+            {
+                ExtendLitterBounds(spr->GetLocation());
+            }
         }
     }
 }
 
 #ifndef DISABLE_NETWORK
 
+#    if DEBUG_LEVEL_1
 template<typename T> void NetworkSerialseEntityType(DataSerialiser& ds)
 {
     for (auto* ent : EntityList<T>())
@@ -243,7 +345,7 @@ template<typename... T> void NetworkSerialiseEntityTypes(DataSerialiser& ds)
     (NetworkSerialseEntityType<T>(ds), ...);
 }
 
-EntitiesChecksum GetAllEntitiesChecksum()
+static EntitiesChecksum GetAllEntitiesChecksumFull()
 {
     EntitiesChecksum checksum{};
 
@@ -253,6 +355,76 @@ EntitiesChecksum GetAllEntitiesChecksum()
 
     return checksum;
 }
+#    endif // DEBUG_LEVEL_1
+
+/**
+ * The words an entity contributed to the last checksum and the entity data they were computed from.
+ * Entities only serialise their own fields, so as long as the data is unchanged the entity contributes
+ * the same words and does not have to be serialised again.
+ */
+struct EntityChecksumCache
+{
+    Entity Data;
+    std::vector<uint64_t> Words;
+};
+static std::vector<std::unique_ptr<EntityChecksumCache>> _entityChecksumCache;
+
+template<typename T> void ChecksumEntityType(OpenRCT2::ChecksumStream& ms)
+{
+    for (auto* ent : EntityList<T>())
+    {
+        const auto index = ent->sprite_index.ToUnderlying();
+        const auto& data = _entities[index];
+        auto& cache = _entityChecksumCache[index];
+        if (cache == nullptr || std::memcmp(&cache->Data, &data, sizeof(Entity)) != 0)
+        {
+            if (cache == nullptr)
+            {
+                cache = std::make_unique<EntityChecksumCache>();
+            }
+            cache->Words.clear();
+
+            EntitiesChecksum unused{};
+            OpenRCT2::ChecksumStream recorder(unused.raw, cache->Words);
+            DataSerialiser ds(true, recorder);
+            ent->Serialise(ds);
+            std::memcpy(&cache->Data, &data, sizeof(Entity));
+        }
+        ms.WriteWords(cache->Words.data(), cache->Words.size());
+    }
+}
+
+template<typename... T> void ChecksumEntityTypes(OpenRCT2::ChecksumStream& ms)
+{
+    (ChecksumEntityType<T>(ms), ...);
+}
+
+EntitiesChecksum GetAllEntitiesChecksum()
+{
+    if (_entityChecksumCache.empty())
+    {
+        _entityChecksumCache.resize(MAX_ENTITIES);
+    }
+
+    EntitiesChecksum checksum{};
+    OpenRCT2::ChecksumStream ms(checksum.raw);
+    ChecksumEntityTypes<Guest, Staff, Vehicle, Litter>(ms);
+
+#    if DEBUG_LEVEL_1
+    // Cross-check the cached words against serialising every entity again.
+    const auto fullChecksum = GetAllEntitiesChecksumFull();
+    if (fullChecksum.raw != checksum.raw)
+    {
+        log_error(
+            "Entity checksum %s does not match full serialisation %s", checksum.ToString().c_str(),
+            fullChecksum.ToString().c_str());
+        Guard::Assert(false, "Incremental entity checksum mismatch");
+        return fullChecksum;
+    }
+#    endif
+
+    return checksum;
+}
 #else
 
 EntitiesChecksum GetAllEntitiesChecksum()
@@ -278,9 +450,8 @@ static void EntityReset(EntityBase* entity)
 static constexpr uint16_t MAX_MISC_SPRITES = 300;
 static void AddToEntityList(EntityBase* entity)
 {
-    auto& list = gEntityLists[EnumValue(entity->Type)];
-    // Entity list must be in sprite_index order to prevent desync issues
-    list.insert(std::lower_bound(std::begin(list), std::end(list), entity->sprite_index), entity->sprite_index);
+    // Entity lists are kept in sprite_index order to prevent desync issues
+    gEntityLists[EnumValue(entity->Type)].insert(entity->sprite_index);
 }
 
 static void AddToFreeList(EntityId index)
@@ -291,12 +462,7 @@ static void AddToFreeList(EntityId index)
 
 static void RemoveFromEntityList(EntityBase* entity)
 {
-    auto& list = gEntityLists[EnumValue(entity->Type)];
-    auto ptr = binary_find(std::begin(list), std::end(list), entity->sprite_index);
-    if (ptr != std::end(list))
-    {
-        list.erase(ptr);
-    }
+    gEntityLists[EnumValue(entity->Type)].erase(entity->sprite_index);
 }
 
 uint16_t GetMiscEntityCount()
@@ -416,6 +582,13 @@ static void EntitySpatialInsert(EntityBase* entity, const CoordsXY& newLoc)
     auto& spatialVector = gEntitySpatialIndex[newIndex];
     auto index = std::lower_bound(std::begin(spatialVector), std::end(spatialVector), entity->sprite_index);
     spatialVector.insert(index, entity->sprite_index);
+
+    if (entity->Type == EntityType::Litter)
+    {
+        auto& litterVector = _litterIndex[GetLitterIndexOffset(newIndex)];
+        auto litterIndex = std::lower_bound(std::begin(litterVector), std::end(litterVector), entity->sprite_index);
+        litterVector.insert(litterIndex, entity->sprite_index);
+    }
 }
 
 static void EntitySpatialRemove(EntityBase* entity)
@@ -426,6 +599,16 @@ static void EntitySpatialRemove(EntityBase* entity)
     if (index != std::end(spatialVector))
     {
         spatialVector.erase(index, index + 1);
+
+        if (entity->Type == EntityType::Litter)
+        {
+            auto& litterVector = _litterIndex[GetLitterIndexOffset(currentIndex)];
+            auto litterIndex = binary_find(std::begin(litterVector), std::end(litterVector), entity->sprite_index);
+            if (litterIndex != std::end(litterVector))
+            {
+                litterVector.erase(litterIndex);
+            }
+        }
     }
     else
     {
@@ -460,6 +643,10 @@ void EntityBase::MoveTo(const CoordsXYZ& newLocation)
     }
 
     EntitySpatialMove(this, loc);
+    if (Type == EntityType::Litter)
+    {
+        ExtendLitterBounds(loc);
+    }
 
     if (loc.x == LOCATION_NULL)
     {
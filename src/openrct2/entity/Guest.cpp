@@ -16,6 +16,7 @@
 #include "../config/Config.h"
 #include "../core/DataSerialiser.h"
 #include "../core/Guard.hpp"
+#include "../core/JobPool.h"
 #include "../core/Numerics.hpp"
 #include "../entity/Balloon.h"
 #include "../entity/EntityRegistry.h"
@@ -48,6 +49,7 @@
 #include "../world/LargeScenery.h"
 #include "../world/Map.h"
 #include "../world/Park.h"
+#include "../world/RidePresence.h"
 #include "../world/Scenery.h"
 #include "../world/Surface.h"
 #include "../world/TileElementsView.h"
@@ -57,6 +59,8 @@
 #include <algorithm>
 #include <functional>
 #include <iterator>
+#include <memory>
+#include <optional>
 
 using namespace OpenRCT2;
 
@@ -439,6 +443,8 @@ static void peep_decide_whether_to_leave_park(Guest* peep);
 static void peep_leave_park(Guest* peep);
 static void peep_head_for_nearest_ride_type(Guest* peep, int32_t rideType);
 static void peep_head_for_nearest_ride_with_flags(Guest* peep, int32_t rideTypeFlags);
+static std::optional<PeepThoughtType> guest_surveys_take_surroundings(const Guest& guest);
+static std::optional<BitSet<OpenRCT2::Limits::MaxRidesInPark>> guest_surveys_take_rides(const Guest& guest);
 bool loc_690FD0(Peep* peep, RideId* rideToView, uint8_t* rideSeatToView, TileElement* tileElement);
 
 template<> bool EntityBase::Is<Guest>() const
@@ -959,7 +965,10 @@ void Guest::Tick128UpdateGuest(int32_t index)
                 SurroundingsThoughtTimeout = 0;
                 if (x != LOCATION_NULL)
                 {
-                    PeepThoughtType thought_type = peep_assess_surroundings(x & 0xFFE0, y & 0xFFE0, z);
+                    auto cachedThought = guest_surveys_take_surroundings(*this);
+                    PeepThoughtType thought_type = cachedThought.has_value()
+                        ? *cachedThought
+                        : peep_assess_surroundings(x & 0xFFE0, y & 0xFFE0, z);
 
                     if (thought_type != PeepThoughtType::None)
                     {
@@ -1834,7 +1843,8 @@ void Guest::PickRideToGoOn()
 Ride* Guest::FindBestRideToGoOn()
 {
     // Pick the most exciting ride
-    auto rideConsideration = FindRidesToGoOn();
+    auto cachedConsideration = guest_surveys_take_rides(*this);
+    auto rideConsideration = cachedConsideration.has_value() ? *cachedConsideration : FindRidesToGoOn();
     Ride* mostExcitingRide = nullptr;
     for (auto& ride : GetRideManager())
     {
@@ -1856,6 +1866,17 @@ Ride* Guest::FindBestRideToGoOn()
     return mostExcitingRide;
 }
 
+/**
+ * The range of tiles around a guest in which they notice rides.
+ */
+static MapRange GetNearbyRidesRange(const CoordsXY& loc)
+{
+    constexpr auto radius = 10 * 32;
+    int32_t cx = floor2(loc.x, 32);
+    int32_t cy = floor2(loc.y, 32);
+    return { cx - radius, cy - radius, cx + radius, cy + radius };
+}
+
 BitSet<OpenRCT2::Limits::MaxRidesInPark> Guest::FindRidesToGoOn()
 {
     BitSet<OpenRCT2::Limits::MaxRidesInPark> rideConsideration;
@@ -1877,27 +1898,7 @@ BitSet<OpenRCT2::Limits::MaxRidesInPark> Guest::FindRidesToGoOn()
     else
     {
         // Take nearby rides into consideration
-        constexpr auto radius = 10 * 32;
-        int32_t cx = floor2(x, 32);
-        int32_t cy = floor2(y, 32);
-        for (int32_t tileX = cx - radius; tileX <= cx + radius; tileX += COORDS_XY_STEP)
-        {
-            for (int32_t tileY = cy - radius; tileY <= cy + radius; tileY += COORDS_XY_STEP)
-            {
-                auto location = CoordsXY{ tileX, tileY };
-                if (!map_is_location_valid(location))
-                    continue;
-
-                for (auto* trackElement : TileElementsView<TrackElement>(location))
-                {
-                    auto rideIndex = trackElement->GetRideIndex();
-                    if (!rideIndex.IsNull())
-                    {
-                        rideConsideration[rideIndex.ToUnderlying()] = true;
-                    }
-                }
-            }
-        }
+        rideConsideration = RidePresenceGetRidesInRange(GetNearbyRidesRange(GetLocation()));
 
         // Always take the tall rides into consideration (realistic as you can usually see them from anywhere in the park)
         for (auto& ride : GetRideManager())
@@ -2970,13 +2971,23 @@ static PeepThoughtType peep_assess_surroundings(int16_t centre_x, int16_t centre
         }
     }
 
-    for (auto litter : EntityList<Litter>())
+    // The 16 bit distances can only wrap around for litter that is not on the map.
+    CoordsXYZ litterMin, litterMax;
+    if (GetLitterBounds(litterMin, litterMax) && map_is_location_valid({ centre_x, centre_y }))
+    {
+        num_rubbish += static_cast<uint16_t>(
+            GetLitterInRange({ centre_x - 160, centre_y - 160, centre_x + 160, centre_y + 160 }).size());
+    }
+    else
     {
-        int16_t dist_x = abs(litter->x - centre_x);
-        int16_t dist_y = abs(litter->y - centre_y);
-        if (std::max(dist_x, dist_y) <= 160)
+        for (auto litter : EntityList<Litter>())
         {
-            num_rubbish++;
+            int16_t dist_x = abs(litter->x - centre_x);
+            int16_t dist_y = abs(litter->y - centre_y);
+            if (std::max(dist_x, dist_y) <= 160)
+            {
+                num_rubbish++;
+            }
         }
     }
 
@@ -2996,6 +3007,150 @@ static PeepThoughtType peep_assess_surroundings(int16_t centre_x, int16_t centre
     return PeepThoughtType::None;
 }
 
+struct GuestSurvey
+{
+    EntityId Id;
+    CoordsXYZ Location;
+    bool WantsSurroundings{};
+    bool WantsRides{};
+    PeepThoughtType Surroundings{ PeepThoughtType::None };
+    BitSet<OpenRCT2::Limits::MaxRidesInPark> Rides;
+};
+
+// Surveys are only valid for the duration of the guest update loop of a single tick.
+static std::vector<GuestSurvey> _guestSurveys;
+static std::vector<CoordsXY> _guestSurveyInvalidations;
+static bool _guestSurveysActive;
+static std::unique_ptr<JobPool> _guestSurveyJobs;
+
+// Surroundings are assessed within 160 units of the guest, allow for the tile rounding.
+static constexpr int32_t GuestSurveySurroundingsRange = 160 + COORDS_XY_STEP;
+
+static void guest_survey_run(GuestSurvey& survey)
+{
+    auto* guest = GetEntity<Guest>(survey.Id);
+    if (guest == nullptr)
+        return;
+
+    if (survey.WantsSurroundings)
+    {
+        survey.Surroundings = peep_assess_surroundings(
+            survey.Location.x & 0xFFE0, survey.Location.y & 0xFFE0, survey.Location.z);
+    }
+    if (survey.WantsRides)
+    {
+        survey.Rides = guest->FindRidesToGoOn();
+    }
+}
+
+/**
+ * Runs the read only tile surveys of all guests that are due their 128 tick update this tick
+ * across the worker pool. The results are consumed in sprite_index order by the serial guest
+ * update, which falls back to surveying directly whenever a result is missing or invalidated,
+ * so the game state is identical to the serial path.
+ */
+void guest_surveys_prepare()
+{
+    _guestSurveys.clear();
+    _guestSurveyInvalidations.clear();
+    _guestSurveysActive = false;
+
+    if (!gConfigGeneral.multithreaded_guest_update)
+        return;
+
+    // Mirrors the selection of guests in peep_update_all and Guest::Tick128UpdateGuest.
+    uint32_t i = 0;
+    for (auto* guest : EntityList<Guest>())
+    {
+        if ((i & 0x1FF) == (gCurrentTicks & 0x1FF) && guest->x != LOCATION_NULL)
+        {
+            GuestSurvey survey{};
+            survey.Id = guest->sprite_index;
+            survey.Location = guest->GetLocation();
+            survey.WantsSurroundings = (guest->State == PeepState::Walking || guest->State == PeepState::Sitting)
+                && guest->SurroundingsThoughtTimeout + 1 >= 18;
+            survey.WantsRides = guest->State == PeepState::Walking && !guest->HasItem(ShopItem::Map);
+            if (survey.WantsRides)
+            {
+                // Queries must not rebuild ride presence blocks on the worker threads.
+                RidePresenceUpdate(GetNearbyRidesRange(survey.Location));
+            }
+            if (survey.WantsSurroundings || survey.WantsRides)
+            {
+                _guestSurveys.push_back(survey);
+            }
+        }
+        i++;
+    }
+
+    if (_guestSurveys.empty())
+        return;
+
+    if (_guestSurveyJobs == nullptr)
+    {
+        _guestSurveyJobs = std::make_unique<JobPool>();
+    }
+    _guestSurveyJobs->ParallelFor(_guestSurveys.size(), [](size_t index) { guest_survey_run(_guestSurveys[index]); });
+    _guestSurveysActive = true;
+}
+
+void guest_surveys_clear()
+{
+    _guestSurveys.clear();
+    _guestSurveyInvalidations.clear();
+    _guestSurveysActive = false;
+}
+
+void guest_surveys_invalidate(const CoordsXY& loc)
+{
+    if (_guestSurveysActive)
+    {
+        _guestSurveyInvalidations.push_back(loc);
+    }
+}
+
+static GuestSurvey* guest_surveys_find(const Guest& guest)
+{
+    if (!_guestSurveysActive)
+        return nullptr;
+
+    auto it = std::lower_bound(
+        _guestSurveys.begin(), _guestSurveys.end(), guest.sprite_index,
+        [](const GuestSurvey& survey, EntityId id) { return survey.Id < id; });
+    if (it == _guestSurveys.end() || it->Id != guest.sprite_index)
+        return nullptr;
+    return &*it;
+}
+
+static std::optional<PeepThoughtType> guest_surveys_take_surroundings(const Guest& guest)
+{
+    auto* survey = guest_surveys_find(guest);
+    if (survey == nullptr || !survey->WantsSurroundings || survey->Location != guest.GetLocation())
+        return std::nullopt;
+
+    survey->WantsSurroundings = false;
+    for (const auto& loc : _guestSurveyInvalidations)
+    {
+        if (std::max(std::abs(loc.x - survey->Location.x), std::abs(loc.y - survey->Location.y))
+            <= GuestSurveySurroundingsRange)
+        {
+            return std::nullopt;
+        }
+    }
+    return survey->Surroundings;
+}
+
+static std::optional<BitSet<OpenRCT2::Limits::MaxRidesInPark>> guest_surveys_take_rides(const Guest& guest)
+{
+    auto* survey = guest_surveys_find(guest);
+    if (survey == nullptr || !survey->WantsRides || survey->Location != guest.GetLocation()
+        || guest.HasItem(ShopItem::Map))
+        return std::nullopt;
+
+    survey->WantsRides = false;
+    return survey->Rides;
+}
+
 /**
  *
  *  rct2: 0x0068F9A9
@@ -3128,29 +3283,12 @@ template<typename T> static void peep_head_for_nearest_ride(Guest* peep, bool co
     else
     {
         // Take nearby rides into consideration
-        constexpr auto searchRadius = 10 * 32;
-        int32_t cx = floor2(peep->x, 32);
-        int32_t cy = floor2(peep->y, 32);
-        for (auto x = cx - searchRadius; x <= cx + searchRadius; x += COORDS_XY_STEP)
+        const auto nearbyRides = RidePresenceGetRidesInRange(GetNearbyRidesRange(peep->GetLocation()));
+        for (const auto& ride : GetRideManager())
         {
-            for (auto y = cy - searchRadius; y <= cy + searchRadius; y += COORDS_XY_STEP)
+            if (nearbyRides[ride.id.ToUnderlying()] && predicate(ride))
             {
-                auto location = CoordsXY{ x, y };
-                if (!map_is_location_valid(location))
-                    continue;
-
-                for (auto* trackElement : TileElementsView<TrackElement>(location))
-                {
-                    auto rideIndex = trackElement->GetRideIndex();
-                    auto ride = get_ride(rideIndex);
-                    if (ride == nullptr)
-                        continue;
-
-                    if (!predicate(*ride))
-                        continue;
-
-                    rideConsideration[ride->id.ToUnderlying()] = true;
-                }
+                rideConsideration[ride.id.ToUnderlying()] = true;
             }
         }
     }
@@ -6141,6 +6279,7 @@ static void peep_update_walking_break_scenery(Guest* peep)
     }
 
     tileElement->SetIsBroken(true);
+    guest_surveys_invalidate(peep->NextLoc);
 
     map_invalidate_tile_zoom1({ peep->NextLoc, tileElement->GetBaseZ(), tileElement->GetBaseZ() + 32 });
 
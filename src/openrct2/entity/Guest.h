@@ -26,6 +26,9 @@
 #define PEEP_NOEXIT_WARNING_THRESHOLD 8
 #define PEEP_LOST_WARNING_THRESHOLD 8
 
+// Thoughts older than this are not reported by warnings or counted for awards.
+#define PEEP_FRESH_THOUGHT_MAX_AGE 5
+
 #define PEEP_MAX_HAPPINESS 255
 #define PEEP_MAX_HUNGER 255
 #define PEEP_MAX_TOILET 255
@@ -334,6 +337,7 @@ public:
     void TryGetUpFromSitting();
     void ChoseNotToGoOnRide(Ride* ride, bool peepAtRide, bool updateLastRide);
     void PickRideToGoOn();
+    OpenRCT2::BitSet<OpenRCT2::Limits::MaxRidesInPark> FindRidesToGoOn();
     void ReadMap();
     bool ShouldGoOnRide(Ride* ride, StationIndex entranceNum, bool atQueue, bool thinking);
     bool ShouldGoToShop(Ride* ride, bool peepAtShop);
@@ -418,7 +422,6 @@ private:
     void MakePassingPeepsSick(Guest* passingPeep);
     void GivePassingPeepsIceCream(Guest* passingPeep);
     Ride* FindBestRideToGoOn();
-    OpenRCT2::BitSet<OpenRCT2::Limits::MaxRidesInPark> FindRidesToGoOn();
     bool FindVehicleToEnter(Ride* ride, std::vector<uint8_t>& car_array);
     void GoToRideEntrance(Ride* ride);
 };
@@ -473,3 +476,7 @@ void increment_guests_in_park();
 void increment_guests_heading_for_park();
 void decrement_guests_in_park();
 void decrement_guests_heading_for_park();
+
+void guest_surveys_prepare();
+void guest_surveys_clear();
+void guest_surveys_invalidate(const CoordsXY& loc);
@@ -0,0 +1,102 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2022 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "GuestHotFields.h"
+
+#include "../profiling/Profiling.h"
+#include "EntityList.h"
+
+// Lost guests that are trying to leave count against the park rating once this low.
+static constexpr uint8_t LostCountdownThreshold = 90;
+
+void GuestHotFields::Resize(size_t count)
+{
+    Happiness.resize(count);
+    PeepFlags.resize(count);
+    ThoughtType.resize(count);
+    ThoughtFreshness.resize(count);
+    HeadingToRide.resize(count);
+    FavouriteRide.resize(count);
+    OutsideOfPark.resize(count);
+    LostCountdown.resize(count);
+}
+
+void GuestHotFields::Gather()
+{
+    PROFILED_FUNCTION();
+
+    Resize(GetEntityListCount(EntityType::Guest));
+
+    size_t i = 0;
+    for (auto* guest : EntityList<Guest>())
+    {
+        Happiness[i] = guest->Happiness;
+        PeepFlags[i] = guest->PeepFlags;
+        ThoughtType[i] = guest->Thoughts[0].type;
+        ThoughtFreshness[i] = guest->Thoughts[0].freshness;
+        HeadingToRide[i] = guest->GuestHeadingToRideId;
+        FavouriteRide[i] = guest->FavouriteRide;
+        OutsideOfPark[i] = guest->OutsideOfPark ? 1 : 0;
+        LostCountdown[i] = guest->GuestIsLostCountdown;
+        i++;
+    }
+    Resize(i);
+}
+
+const GuestHotFields& GuestHotFields::GatherShared()
+{
+    // Shrinking the arrays keeps their capacity, so gathering again does not allocate unless the guest count grows.
+    static GuestHotFields shared;
+    shared.Gather();
+    return shared;
+}
+
+uint32_t GuestHotFields::CountInPark() const
+{
+    uint32_t count = 0;
+    for (size_t i = 0; i < size(); i++)
+    {
+        count += OutsideOfPark[i] == 0;
+    }
+    return count;
+}
+
+uint32_t GuestHotFields::CountHappierInPark(uint8_t happiness) const
+{
+    uint32_t count = 0;
+    for (size_t i = 0; i < size(); i++)
+    {
+        count += (OutsideOfPark[i] == 0) & (Happiness[i] > happiness);
+    }
+    return count;
+}
+
+uint32_t GuestHotFields::CountLostInPark() const
+{
+    uint32_t count = 0;
+    for (size_t i = 0; i < size(); i++)
+    {
+        count += (OutsideOfPark[i] == 0) & ((PeepFlags[i] & PEEP_FLAGS_LEAVING_PARK) != 0)
+            & (LostCountdown[i] < LostCountdownThreshold);
+    }
+    return count;
+}
+
+GuestHotFields::ThoughtCounts GuestHotFields::CountFreshThoughtsInPark() const
+{
+    ThoughtCounts counts{};
+    for (size_t i = 0; i < size(); i++)
+    {
+        if (OutsideOfPark[i] == 0 && ThoughtFreshness[i] <= PEEP_FRESH_THOUGHT_MAX_AGE)
+        {
+            counts[EnumValue(ThoughtType[i])]++;
+        }
+    }
+    return counts;
+}
@@ -0,0 +1,72 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2022 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../Identifiers.h"
+#include "Guest.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Structure of arrays copy of the guest fields read by the park wide passes (park rating, guest warnings, awards
+ * and favourite rides). Each guest lives in its own 512 byte entity slot, so a pass over a byte or two of every
+ * guest pulls in a cache line per guest. Passes that run together gather the fields once and then run as linear
+ * passes over the arrays. Rows are in sprite_index order, the same order as EntityList<Guest>.
+ *
+ * The copy is not kept up to date, it is only valid until guests are next modified. The passes share one copy whose
+ * storage is reused, see GatherShared.
+ */
+struct GuestHotFields
+{
+    using ThoughtCounts = std::array<uint32_t, 256>;
+
+    std::vector<uint8_t> Happiness;
+    std::vector<uint32_t> PeepFlags;
+    std::vector<PeepThoughtType> ThoughtType;
+    std::vector<uint8_t> ThoughtFreshness;
+    std::vector<RideId> HeadingToRide;
+    std::vector<RideId> FavouriteRide;
+    std::vector<uint8_t> OutsideOfPark;
+    std::vector<uint8_t> LostCountdown;
+
+    /**
+     * Copies the fields of every guest.
+     */
+    void Gather();
+
+    /**
+     * Gathers the copy shared by the passes of the game thread and returns it.
+     */
+    static const GuestHotFields& GatherShared();
+
+    size_t size() const
+    {
+        return Happiness.size();
+    }
+
+    uint32_t CountInPark() const;
+    uint32_t CountHappierInPark(uint8_t happiness) const;
+
+    /**
+     * Guests in the park that are trying to leave and have been lost for a while.
+     */
+    uint32_t CountLostInPark() const;
+
+    /**
+     * Counts the first thought of guests in the park, indexed by thought type. Only fresh thoughts are counted,
+     * like the guest warnings and awards do.
+     */
+    ThoughtCounts CountFreshThoughtsInPark() const;
+
+private:
+    void Resize(size_t count);
+};
@@ -10,6 +10,7 @@
 #include "../world/Map.h"
 #include "EntityList.h"
 #include "EntityRegistry.h"
+#include "Guest.h"
 
 template<> bool EntityBase::Is<Litter>() const
 {
@@ -71,6 +72,7 @@ void Litter::Create(const CoordsXYZD& litterPos, Type type)
 
         if (newestLitter != nullptr)
         {
+            guest_surveys_invalidate(newestLitter->GetLocation());
             newestLitter->Invalidate();
             EntityRemove(newestLitter);
         }
@@ -87,6 +89,7 @@ void Litter::Create(const CoordsXYZD& litterPos, Type type)
     litter->SubType = type;
     litter->MoveTo(offsetLitterPos);
     litter->creationTick = gCurrentTicks;
+    guest_surveys_invalidate(offsetLitterPos);
 }
 
 /**
@@ -108,6 +111,7 @@ void Litter::RemoveAt(const CoordsXYZ& litterPos)
     }
     for (auto* litter : removals)
     {
+        guest_surveys_invalidate(litter->GetLocation());
         litter->Invalidate();
         EntityRemove(litter);
     }
@@ -23,6 +23,7 @@
 #include "../entity/Balloon.h"
 #include "../entity/EntityRegistry.h"
 #include "../entity/EntityTweener.h"
+#include "../entity/GuestHotFields.h"
 #include "../interface/Window.h"
 #include "../localisation/Formatter.h"
 #include "../localisation/Localisation.h"
@@ -204,6 +205,8 @@ void peep_update_all()
     if (gScreenFlags & SCREEN_FLAGS_EDITOR)
         return;
 
+    guest_surveys_prepare();
+
     int32_t i = 0;
     // Warning this loop can delete peeps
     for (auto peep : EntityList<Guest>())
@@ -225,6 +228,8 @@ void peep_update_all()
         i++;
     }
 
+    guest_surveys_clear();
+
     for (auto staff : EntityList<Staff>())
     {
         if (static_cast<uint32_t>(i & 0x7F) != (gCurrentTicks & 0x7F))
@@ -1005,53 +1010,54 @@ void Peep::Update()
  *
  *  rct2: 0x0069BF41
  */
-void peep_problem_warnings_update()
+void peep_problem_warnings_update(const GuestHotFields& guests)
 {
     Ride* ride;
     uint32_t hunger_counter = 0, lost_counter = 0, noexit_counter = 0, thirst_counter = 0, litter_counter = 0,
              disgust_counter = 0, toilet_counter = 0, vandalism_counter = 0;
     uint8_t* warning_throttle = gPeepWarningThrottle;
 
-    for (auto peep : EntityList<Guest>())
+    for (size_t i = 0; i < guests.size(); i++)
     {
-        if (peep->OutsideOfPark || peep->Thoughts[0].freshness > 5)
+        if (guests.OutsideOfPark[i] || guests.ThoughtFreshness[i] > PEEP_FRESH_THOUGHT_MAX_AGE)
             continue;
 
-        switch (peep->Thoughts[0].type)
+        const auto headingToRideId = guests.HeadingToRide[i];
+        switch (guests.ThoughtType[i])
         {
             case PeepThoughtType::Lost: // 0x10
                 lost_counter++;
                 break;
 
             case PeepThoughtType::Hungry: // 0x14
-                if (peep->GuestHeadingToRideId.IsNull())
+                if (headingToRideId.IsNull())
                 {
                     hunger_counter++;
                     break;
                 }
-                ride = get_ride(peep->GuestHeadingToRideId);
+                ride = get_ride(headingToRideId);
                 if (ride != nullptr && !ride->GetRideTypeDescriptor().HasFlag(RIDE_TYPE_FLAG_FLAT_RIDE))
                     hunger_counter++;
                 break;
 
             case PeepThoughtType::Thirsty:
-                if (peep->GuestHeadingToRideId.IsNull())
+                if (headingToRideId.IsNull())
                 {
                     thirst_counter++;
                     break;
                 }
-                ride = get_ride(peep->GuestHeadingToRideId);
+                ride = get_ride(headingToRideId);
                 if (ride != nullptr && !ride->GetRideTypeDescriptor().HasFlag(RIDE_TYPE_FLAG_SELLS_DRINKS))
                     thirst_counter++;
                 break;
 
             case PeepThoughtType::Toilet:
-                if (peep->GuestHeadingToRideId.IsNull())
+                if (headingToRideId.IsNull())
                 {
                     toilet_counter++;
                     break;
                 }
-                ride = get_ride(peep->GuestHeadingToRideId);
+                ride = get_ride(headingToRideId);
                 if (ride != nullptr && !ride->GetRideTypeDescriptor().HasFlag(RIDE_TYPE_FLAG_IS_TOILET))
                     toilet_counter++;
                 break;
@@ -306,6 +306,7 @@ enum PeepInvalidate
 };
 
 struct Guest;
+struct GuestHotFields;
 struct Staff;
 
 struct Peep : EntityBase
@@ -460,7 +461,7 @@ extern uint8_t gPeepWarningThrottle[16];
 
 int32_t peep_get_staff_count();
 void peep_update_all();
-void peep_problem_warnings_update();
+void peep_problem_warnings_update(const GuestHotFields& guests);
 void peep_stop_crowd_noise();
 void peep_update_crowd_noise();
 void peep_update_days_in_queue();
@@ -45,6 +45,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <limits>
 
 // clang-format off
 const rct_string_id StaffCostumeNames[] = {
@@ -321,6 +322,22 @@ bool Staff::HasPatrolArea() const
     return PatrolInfo == nullptr ? false : !PatrolInfo->IsEmpty();
 }
 
+/**
+ * Whether the 16 bit litter distance can wrap around for any litter, in which case litter that is far away can be
+ * picked as the nearest.
+ */
+static bool HandymanLitterDistanceCanWrap(const CoordsXYZ& loc)
+{
+    CoordsXYZ litterMin, litterMax;
+    if (!GetLitterBounds(litterMin, litterMax))
+        return true;
+
+    const auto dx = std::max(std::abs(loc.x - litterMin.x), std::abs(litterMax.x - loc.x));
+    const auto dy = std::max(std::abs(loc.y - litterMin.y), std::abs(litterMax.y - loc.y));
+    const auto dz = std::max(std::abs(loc.z - litterMin.z), std::abs(litterMax.z - loc.z));
+    return static_cast<int64_t>(dx) + dy + static_cast<int64_t>(dz) * 4 > std::numeric_limits<uint16_t>::max();
+}
+
 /**
  *
  *  rct2: 0x006BFBE8
@@ -331,8 +348,7 @@ Direction Staff::HandymanDirectionToNearestLitter() const
 {
     uint16_t nearestLitterDist = 0xFFFF;
     Litter* nearestLitter = nullptr;
-    for (auto litter : EntityList<Litter>())
-    {
+    auto checkLitter = [&](Litter* litter) {
         uint16_t distance = abs(litter->x - x) + abs(litter->y - y) + abs(litter->z - z) * 4;
 
         if (distance < nearestLitterDist)
@@ -340,6 +356,25 @@ Direction Staff::HandymanDirectionToNearestLitter() const
             nearestLitterDist = distance;
             nearestLitter = litter;
         }
+    };
+
+    if (HandymanLitterDistanceCanWrap(GetLocation()))
+    {
+        for (auto litter : EntityList<Litter>())
+        {
+            checkLitter(litter);
+        }
+    }
+    else
+    {
+        // Only litter within the maximum distance can be picked, both lists are in sprite_index order so ties
+        // resolve the same way.
+        auto range = MapRange(
+            x - MAX_LITTER_DISTANCE, y - MAX_LITTER_DISTANCE, x + MAX_LITTER_DISTANCE, y + MAX_LITTER_DISTANCE);
+        for (auto* litter : GetLitterInRange(range))
+        {
+            checkLitter(litter);
+        }
     }
 
     if (nearestLitterDist > MAX_LITTER_DISTANCE)
@@ -46,6 +46,7 @@
 #include "../object/ObjectRepository.h"
 #include "../platform/Platform.h"
 #include "../profiling/Profiling.h"
+#include "../profiling/TickStats.h"
 #include "../ride/Ride.h"
 #include "../ride/RideData.h"
 #include "../ride/Vehicle.h"
@@ -1737,6 +1738,12 @@ static int32_t cc_profiler_start([[maybe_unused]] InteractiveConsole& console, [
     if (!OpenRCT2::Profiling::IsEnabled())
         console.WriteLine("Started profiler");
     OpenRCT2::Profiling::Enable();
+
+    if (argv.size() >= 1 && argv[0] == "trace")
+    {
+        console.WriteLine("Recording trace");
+        OpenRCT2::Profiling::StartTrace();
+    }
     return 0;
 }
 
@@ -1759,21 +1766,106 @@ static int32_t cc_profiler_exportcsv([[maybe_unused]] InteractiveConsole& consol
     return 0;
 }
 
+static int32_t cc_profiler_exporttrace(InteractiveConsole& console, const arguments_t& argv)
+{
+    if (argv.size() < 1)
+    {
+        console.WriteLineError("Missing argument: <file path>");
+        return 1;
+    }
+
+    const auto& traceFilePath = argv[0];
+    if (!OpenRCT2::Profiling::ExportTrace(traceFilePath))
+    {
+        console.WriteFormatLine("Unable to export trace file to %s", traceFilePath.c_str());
+        return 1;
+    }
+
+    console.WriteFormatLine("Wrote trace file: \"%s\"", traceFilePath.c_str());
+    return 0;
+}
+
 static int32_t cc_profiler_stop([[maybe_unused]] InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
 {
     if (OpenRCT2::Profiling::IsEnabled())
         console.WriteLine("Stopped profiler");
     OpenRCT2::Profiling::Disable();
+    const auto wasTracing = OpenRCT2::Profiling::IsTracing();
+    OpenRCT2::Profiling::StopTrace();
 
-    // Export to CSV if argument is provided.
+    // Export the trace or a CSV if argument is provided.
     if (argv.size() >= 1)
     {
+        if (wasTracing)
+        {
+            return cc_profiler_exporttrace(console, argv);
+        }
         return cc_profiler_exportcsv(console, argv);
     }
 
     return 0;
 }
 
+static int32_t cc_tick_stats(InteractiveConsole& console, const arguments_t& argv)
+{
+    if (!argv.empty() && argv[0] == "reset")
+    {
+        OpenRCT2::TickStats::Reset();
+        console.WriteLine("Reset tick stats");
+        return 0;
+    }
+
+    if (!argv.empty() && argv[0] == "dump")
+    {
+        if (argv.size() < 2)
+        {
+            OpenRCT2::TickStats::SetDumpFile({});
+            console.WriteLine("Stopped writing tick stats");
+            return 0;
+        }
+
+        auto interval = static_cast<int32_t>(OpenRCT2::TickStats::WindowSize);
+        if (argv.size() >= 3)
+        {
+            bool valid = false;
+            interval = console_parse_int(argv[2], &valid);
+            if (!valid || interval <= 0)
+            {
+                console.WriteLineError("Invalid interval, expected a number of ticks");
+                return 1;
+            }
+        }
+
+        const auto path = Path::GetAbsolute(argv[1]);
+        if (!OpenRCT2::TickStats::AppendToFile(path))
+        {
+            console.WriteFormatLine("Unable to write tick stats to %s", path.c_str());
+            return 1;
+        }
+        OpenRCT2::TickStats::SetDumpFile(path, static_cast<uint32_t>(interval));
+        console.WriteFormatLine("Writing tick stats to \"%s\" every %d ticks", path.c_str(), interval);
+        return 0;
+    }
+
+    const auto summary = OpenRCT2::TickStats::GetSummary();
+    console.WriteFormatLine("Tick %u, times in ms over the last %zu ticks:", summary.CurrentTick, summary.NumTicks);
+    console.WriteFormatLine("%-30s %9s %9s %9s %9s", "Part", "p50", "p95", "p99", "max");
+    for (const auto& part : summary.Parts)
+    {
+        console.WriteFormatLine(
+            "%-30s %9.3f %9.3f %9.3f %9.3f", std::string(part.Name).c_str(), part.P50, part.P95, part.P99, part.Max);
+    }
+    for (const auto& [name, count] : summary.EntityCounts)
+    {
+        if (count != 0)
+        {
+            console.WriteFormatLine("Entities (%s): %u", std::string(name).c_str(), count);
+        }
+    }
+    console.WriteFormatLine("Tile elements: %zu", summary.TileElementCount);
+    return 0;
+}
+
 using console_command_func = int32_t (*)(InteractiveConsole& console, const arguments_t& argv);
 struct console_command
 {
@@ -1879,9 +1971,16 @@ static constexpr const console_command console_command_table[] = {
     { "mp_desync", cc_mp_desync, "Forces a multiplayer desync",
       "cc_mp_desync [desync_type, 0 = Random t-shirt color on random guest, 1 = Remove random guest ]" },
     { "profiler_reset", cc_profiler_reset, "Resets the profiler data.", "profiler_reset" },
-    { "profiler_start", cc_profiler_start, "Starts the profiler.", "profiler_start" },
-    { "profiler_stop", cc_profiler_stop, "Stops the profiler.", "profiler_stop [<output file>]" },
+    { "profiler_start", cc_profiler_start, "Starts the profiler, trace also records a timeline of the profiled calls.",
+      "profiler_start [trace]" },
+    { "profiler_stop", cc_profiler_stop, "Stops the profiler, exporting the trace if one was recorded or else the CSV.",
+      "profiler_stop [<output file>]" },
     { "profiler_exportcsv", cc_profiler_exportcsv, "Exports the current profiler data.", "profiler_exportcsv <output file>" },
+    { "profiler_exporttrace", cc_profiler_exporttrace, "Exports the recorded trace as Chrome trace event JSON.",
+      "profiler_exporttrace <output file>" },
+    { "tick_stats", cc_tick_stats,
+      "Shows how long each part of the recent game ticks took, or appends the stats to a file every interval ticks.",
+      "tick_stats [reset | dump [<output file> [<interval ticks>]]]" },
 };
 
 static int32_t cc_windows(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
@@ -33,9 +33,11 @@
 #include "../world/Surface.h"
 #include "Viewport.h"
 
+#include <array>
 #include <cctype>
 #include <chrono>
 #include <cstdlib>
+#include <future>
 #include <memory>
 #include <optional>
 #include <string>
@@ -46,6 +48,9 @@ using namespace OpenRCT2::Drawing;
 
 uint8_t gScreenshotCountdown = 0;
 
+// Height in pixels of the strips a screenshot is rendered in when no tile size is given.
+static constexpr int32_t DefaultScreenshotTileSize = 256;
+
 static bool WriteDpiToFile(std::string_view path, const rct_drawpixelinfo* dpi, const GamePalette& palette)
 {
     auto const pixels8 = dpi->bits;
@@ -380,9 +385,76 @@ static void RenderViewport(IDrawingEngine* drawingEngine, const rct_viewport& vi
     viewport_render(&dpi, &viewport, { { 0, 0 }, { viewport.width, viewport.height } });
 }
 
+/**
+ * Renders the viewport in horizontal strips and streams their rows straight into the file, so only two strips are held
+ * in memory however large the image is. The next strip is painted on another thread while the current one is encoded.
+ */
+static void WriteViewportToFile(std::string_view path, const rct_viewport& viewport, int32_t tileSize)
+{
+    if (tileSize <= 0)
+    {
+        tileSize = DefaultScreenshotTileSize;
+    }
+    // Keep the strip edges on whole pixels when zoomed in.
+    tileSize = (tileSize + 7) & ~7;
+
+    const int32_t width = viewport.width;
+    const int32_t height = viewport.height;
+    const int32_t stripHeight = std::max(1, std::min(tileSize, height));
+    const size_t stripSize = static_cast<size_t>(width) * stripHeight;
+
+    // Ensure sprites appear regardless of rotation
+    reset_all_sprite_quadrant_placements();
+
+    X8DrawingEngine drawingEngine(GetContext()->GetUiContext());
+    std::array<std::vector<uint8_t>, 2> strips;
+    for (auto& strip : strips)
+    {
+        strip.resize(stripSize);
+    }
+
+    auto renderStrip = [&viewport, &drawingEngine, width, height, stripHeight](std::vector<uint8_t>& strip, int32_t top) {
+        std::fill(strip.begin(), strip.end(), PALETTE_INDEX_0);
+
+        rct_drawpixelinfo dpi;
+        dpi.bits = strip.data();
+        dpi.x = viewport.pos.x;
+        dpi.y = viewport.pos.y + top;
+        dpi.width = width;
+        dpi.height = std::min(stripHeight, height - top);
+        dpi.DrawingEngine = &drawingEngine;
+        viewport_render(&dpi, &viewport, { { dpi.x, dpi.y }, { dpi.x + dpi.width, dpi.y + dpi.height } });
+    };
+
+    // Declared after the strips, so an exception waits for a pending strip before its buffer is released.
+    std::future<void> pendingStrip;
+    if (height > 0)
+    {
+        pendingStrip = std::async(std::launch::async, renderStrip, std::ref(strips[0]), 0);
+    }
+
+    Imaging::WriteRowsToFile(
+        path, width, height, gPalette,
+        [&](uint32_t y) {
+            const auto stripIndex = y / stripHeight;
+            const auto stripRow = y % stripHeight;
+            if (stripRow == 0)
+            {
+                pendingStrip.get();
+                const auto nextTop = static_cast<int32_t>((stripIndex + 1) * stripHeight);
+                if (nextTop < height)
+                {
+                    pendingStrip = std::async(
+                        std::launch::async, renderStrip, std::ref(strips[(stripIndex + 1) % 2]), nextTop);
+                }
+            }
+            return strips[stripIndex % 2].data() + static_cast<size_t>(stripRow) * width;
+        },
+        IMAGE_FORMAT::PNG);
+}
+
 void screenshot_giant()
 {
-    rct_drawpixelinfo dpi{};
     try
     {
         auto path = screenshot_get_next_path();
@@ -410,10 +482,7 @@ void screenshot_giant()
             viewport.flags |= VIEWPORT_FLAG_TRANSPARENT_BACKGROUND;
         }
 
-        dpi = CreateDPI(viewport);
-
-        RenderViewport(nullptr, viewport, dpi);
-        WriteDpiToFile(path.value(), &dpi, gPalette);
+        WriteViewportToFile(path.value(), viewport, DefaultScreenshotTileSize);
 
         // Show user that screenshot saved successfully
         const auto filename = Path::GetFileName(path.value());
@@ -427,8 +496,6 @@ void screenshot_giant()
         log_error("%s", e.what());
         context_show_error(STR_SCREENSHOT_FAILED, STR_NONE, {});
     }
-
-    ReleaseDPI(dpi);
 }
 
 // TODO: Move this at some point into a more appropriate place.
@@ -625,7 +692,6 @@ int32_t cmdline_for_screenshot(const char** argv, int32_t argc, ScreenshotOption
     }
 
     int32_t exitCode = 1;
-    rct_drawpixelinfo dpi;
     try
     {
         Platform::CoreInit();
@@ -728,17 +794,13 @@ int32_t cmdline_for_screenshot(const char** argv, int32_t argc, ScreenshotOption
 
         ApplyOptions(options, viewport);
 
-        dpi = CreateDPI(viewport);
-
-        RenderViewport(nullptr, viewport, dpi);
-        WriteDpiToFile(outputPath, &dpi, gPalette);
+        WriteViewportToFile(outputPath, viewport, options->tile_size);
     }
     catch (const std::exception& e)
     {
         std::printf("%s\n", e.what());
         exitCode = -1;
     }
-    ReleaseDPI(dpi);
 
     drawing_engine_dispose();
 
@@ -825,10 +887,7 @@ void CaptureImage(const CaptureOptions& options)
     }
 
     auto outputPath = ResolveFilenameForCapture(options.Filename);
-    auto dpi = CreateDPI(viewport);
-    RenderViewport(nullptr, viewport, dpi);
-    WriteDpiToFile(outputPath, &dpi, gPalette);
-    ReleaseDPI(dpi);
+    WriteViewportToFile(outputPath, viewport, DefaultScreenshotTileSize);
 
     gCurrentRotation = backupRotation;
 }
@@ -34,6 +34,7 @@ struct ScreenshotOptions
     bool remove_litter = false;
     bool tidy_up_park = false;
     bool transparent = false;
+    int32_t tile_size = 0;
 };
 
 struct CaptureView
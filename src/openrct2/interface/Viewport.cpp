@@ -23,6 +23,7 @@
 #include "../entity/PatrolArea.h"
 #include "../entity/Staff.h"
 #include "../paint/Paint.h"
+#include "../paint/PaintCache.h"
 #include "../profiling/Profiling.h"
 #include "../ride/Ride.h"
 #include "../ride/TrackDesign.h"
@@ -220,6 +221,11 @@ void viewport_remove(rct_viewport* viewport)
     _viewports.erase(it);
 }
 
+static bool viewport_is_window_viewport(const rct_viewport* viewport)
+{
+    return std::any_of(_viewports.begin(), _viewports.end(), [viewport](const auto& vp) { return &vp == viewport; });
+}
+
 void viewports_invalidate(const ScreenRect& screenRect, ZoomLevel maxZoom)
 {
     for (auto& vp : _viewports)
@@ -1013,8 +1019,12 @@ void viewport_paint(
         useParallelDrawing = true;
     }
 
+    // Recorded sessions are used by the benchmark, which measures painting every tile. Screenshots and previews use
+    // viewports of their own that are painted once, caching them would only evict the columns of window viewports.
+    const bool useTileCache = recorded_sessions == nullptr && viewport_is_window_viewport(viewport)
+        && PaintCacheBeginViewport(viewFlags);
+
     // Create space to record sessions and keep track which index is being drawn
-    size_t index = 0;
     if (recorded_sessions != nullptr)
     {
         auto columnSize = rightBorder - alignedX;
@@ -1022,8 +1032,8 @@ void viewport_paint(
         recorded_sessions->resize(columnCount);
     }
 
-    // Generate and sort columns.
-    for (x = alignedX; x < rightBorder; x += 32, index++)
+    // Set up the columns.
+    for (x = alignedX; x < rightBorder; x += 32)
     {
         paint_session* session = PaintSessionAlloc(&dpi1, viewFlags);
         _paintColumns.push_back(session);
@@ -1047,38 +1057,41 @@ void viewport_paint(
         }
         dpi2.width = paintRight - dpi2.x;
 
-        if (useMultithreading)
-        {
-            _paintJobs->AddTask(
-                [session, recorded_sessions, index]() -> void { viewport_fill_column(*session, recorded_sessions, index); });
-        }
-        else
+        if (useTileCache)
         {
-            viewport_fill_column(*session, recorded_sessions, index);
+            session->TileCache = PaintCacheGetColumn(*session);
         }
     }
 
+    // Generate and sort columns. Columns cost very different amounts, so with parallel drawing each column is drawn as
+    // soon as it is sorted rather than waiting for the others.
     if (useMultithreading)
     {
-        _paintJobs->Join();
+        _paintJobs->ParallelFor(_paintColumns.size(), [recorded_sessions, useParallelDrawing](size_t index) {
+            auto& session = *_paintColumns[index];
+            viewport_fill_column(session, recorded_sessions, index);
+            if (useParallelDrawing)
+            {
+                viewport_paint_column(session);
+            }
+        });
     }
-
-    // Paint columns.
-    for (auto* session : _paintColumns)
+    else
     {
-        if (useParallelDrawing)
+        for (size_t index = 0; index < _paintColumns.size(); index++)
         {
-            _paintJobs->AddTask([session]() -> void { viewport_paint_column(*session); });
+            viewport_fill_column(*_paintColumns[index], recorded_sessions, index);
         }
-        else
+    }
+
+    // Paint columns.
+    if (!useParallelDrawing)
+    {
+        for (auto* session : _paintColumns)
         {
             viewport_paint_column(*session);
         }
     }
-    if (useParallelDrawing)
-    {
-        _paintJobs->Join();
-    }
 
     // Release resources.
     for (auto* session : _paintColumns)
@@ -11,6 +11,7 @@
 
 #include "../config/Config.h"
 #include "../entity/Guest.h"
+#include "../entity/GuestHotFields.h"
 #include "../interface/Window.h"
 #include "../localisation/Localisation.h"
 #include "../localisation/StringIds.h"
@@ -80,8 +81,14 @@ bool award_is_positive(AwardType type)
 
 #pragma region Award checks
 
+static uint32_t award_count_untidy_thoughts(const GuestHotFields::ThoughtCounts& thoughts)
+{
+    return thoughts[EnumValue(PeepThoughtType::BadLitter)] + thoughts[EnumValue(PeepThoughtType::PathDisgusting)]
+        + thoughts[EnumValue(PeepThoughtType::Vandalism)];
+}
+
 /** More than 1/16 of the total guests must be thinking untidy thoughts. */
-static bool award_is_deserved_most_untidy(int32_t activeAwardTypes)
+static bool award_is_deserved_most_untidy(int32_t activeAwardTypes, const GuestHotFields& guests)
 {
     if (activeAwardTypes & EnumToFlag(AwardType::MostBeautiful))
         return false;
@@ -90,60 +97,30 @@ static bool award_is_deserved_most_untidy(int32_t activeAwardTypes)
     if (activeAwardTypes & EnumToFlag(AwardType::MostTidy))
         return false;
 
-    uint32_t negativeCount = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness > 5)
-            continue;
-
-        if (thought.type == PeepThoughtType::BadLitter || thought.type == PeepThoughtType::PathDisgusting
-            || thought.type == PeepThoughtType::Vandalism)
-        {
-            negativeCount++;
-        }
-    }
+    const auto thoughts = guests.CountFreshThoughtsInPark();
+    uint32_t negativeCount = award_count_untidy_thoughts(thoughts);
 
     return (negativeCount > gNumGuestsInPark / 16);
 }
 
 /** More than 1/64 of the total guests must be thinking tidy thoughts and less than 6 guests thinking untidy thoughts. */
-static bool award_is_deserved_most_tidy(int32_t activeAwardTypes)
+static bool award_is_deserved_most_tidy(int32_t activeAwardTypes, const GuestHotFields& guests)
 {
     if (activeAwardTypes & EnumToFlag(AwardType::MostUntidy))
         return false;
     if (activeAwardTypes & EnumToFlag(AwardType::MostDisappointing))
         return false;
 
-    uint32_t positiveCount = 0;
-    uint32_t negativeCount = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness > 5)
-            continue;
-
-        if (thought.type == PeepThoughtType::VeryClean)
-            positiveCount++;
-
-        if (thought.type == PeepThoughtType::BadLitter || thought.type == PeepThoughtType::PathDisgusting
-            || thought.type == PeepThoughtType::Vandalism)
-        {
-            negativeCount++;
-        }
-    }
+    const auto thoughts = guests.CountFreshThoughtsInPark();
+    uint32_t positiveCount = thoughts[EnumValue(PeepThoughtType::VeryClean)];
+    uint32_t negativeCount = award_count_untidy_thoughts(thoughts);
 
     return (negativeCount <= 5 && positiveCount > gNumGuestsInPark / 64);
 }
 
 /** At least 6 open roller coasters. */
-static bool award_is_deserved_best_rollercoasters([[maybe_unused]] int32_t activeAwardTypes)
+static bool award_is_deserved_best_rollercoasters(
+    [[maybe_unused]] int32_t activeAwardTypes, [[maybe_unused]] const GuestHotFields& guests)
 {
     auto rollerCoasters = 0;
     for (const auto& ride : GetRideManager())
@@ -170,7 +147,7 @@ static bool award_is_deserved_best_rollercoasters([[maybe_unused]] int32_t activ
 }
 
 /** Entrance fee is 0.10 less than half of the total ride value. */
-static bool award_is_deserved_best_value(int32_t activeAwardTypes)
+static bool award_is_deserved_best_value(int32_t activeAwardTypes, [[maybe_unused]] const GuestHotFields& guests)
 {
     if (activeAwardTypes & EnumToFlag(AwardType::WorstValue))
         return false;
@@ -191,40 +168,22 @@ static bool award_is_deserved_best_value(int32_t activeAwardTypes)
 }
 
 /** More than 1/128 of the total guests must be thinking scenic thoughts and fewer than 16 untidy thoughts. */
-static bool award_is_deserved_most_beautiful(int32_t activeAwardTypes)
+static bool award_is_deserved_most_beautiful(int32_t activeAwardTypes, const GuestHotFields& guests)
 {
     if (activeAwardTypes & EnumToFlag(AwardType::MostUntidy))
         return false;
     if (activeAwardTypes & EnumToFlag(AwardType::MostDisappointing))
         return false;
 
-    uint32_t positiveCount = 0;
-    uint32_t negativeCount = 0;
-    auto list = EntityList<Guest>();
-    for (auto peep : list)
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness > 5)
-            continue;
-
-        if (thought.type == PeepThoughtType::Scenery)
-            positiveCount++;
-
-        if (thought.type == PeepThoughtType::BadLitter || thought.type == PeepThoughtType::PathDisgusting
-            || thought.type == PeepThoughtType::Vandalism)
-        {
-            negativeCount++;
-        }
-    }
+    const auto thoughts = guests.CountFreshThoughtsInPark();
+    uint32_t positiveCount = thoughts[EnumValue(PeepThoughtType::Scenery)];
+    uint32_t negativeCount = award_count_untidy_thoughts(thoughts);
 
     return (negativeCount <= 15 && positiveCount > gNumGuestsInPark / 128);
 }
 
 /** Entrance fee is more than total ride value. */
-static bool award_is_deserved_worst_value(int32_t activeAwardTypes)
+static bool award_is_deserved_worst_value(int32_t activeAwardTypes, [[maybe_unused]] const GuestHotFields& guests)
 {
     if (activeAwardTypes & EnumToFlag(AwardType::BestValue))
         return false;
@@ -240,18 +199,9 @@ static bool award_is_deserved_worst_value(int32_t activeAwardTypes)
 }
 
 /** No more than 2 people who think the vandalism is bad and no crashes. */
-static bool award_is_deserved_safest([[maybe_unused]] int32_t activeAwardTypes)
+static bool award_is_deserved_safest([[maybe_unused]] int32_t activeAwardTypes, const GuestHotFields& guests)
 {
-    auto peepsWhoDislikeVandalism = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness <= 5 && thought.type == PeepThoughtType::Vandalism)
-            peepsWhoDislikeVandalism++;
-    }
+    auto peepsWhoDislikeVandalism = guests.CountFreshThoughtsInPark()[EnumValue(PeepThoughtType::Vandalism)];
 
     if (peepsWhoDislikeVandalism > 2)
         return false;
@@ -269,7 +219,7 @@ static bool award_is_deserved_safest([[maybe_unused]] int32_t activeAwardTypes)
 }
 
 /** All staff types, at least 20 staff, one staff per 32 peeps. */
-static bool award_is_deserved_best_staff(int32_t activeAwardTypes)
+static bool award_is_deserved_best_staff(int32_t activeAwardTypes, [[maybe_unused]] const GuestHotFields& guests)
 {
     if (activeAwardTypes & EnumToFlag(AwardType::MostUntidy))
         return false;
@@ -281,7 +231,7 @@ static bool award_is_deserved_best_staff(int32_t activeAwardTypes)
 }
 
 /** At least 7 shops, 4 unique, one shop per 128 guests and no more than 12 hungry guests. */
-static bool award_is_deserved_best_food(int32_t activeAwardTypes)
+static bool award_is_deserved_best_food(int32_t activeAwardTypes, const GuestHotFields& guests)
 {
     if (activeAwardTypes & EnumToFlag(AwardType::WorstFood))
         return false;
@@ -312,21 +262,12 @@ static bool award_is_deserved_best_food(int32_t activeAwardTypes)
         return false;
 
     // Count hungry peeps
-    auto hungryPeeps = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness <= 5 && thought.type == PeepThoughtType::Hungry)
-            hungryPeeps++;
-    }
+    auto hungryPeeps = guests.CountFreshThoughtsInPark()[EnumValue(PeepThoughtType::Hungry)];
     return (hungryPeeps <= 12);
 }
 
 /** No more than 2 unique shops, less than one shop per 256 guests and more than 15 hungry guests. */
-static bool award_is_deserved_worst_food(int32_t activeAwardTypes)
+static bool award_is_deserved_worst_food(int32_t activeAwardTypes, const GuestHotFields& guests)
 {
     if (activeAwardTypes & EnumToFlag(AwardType::BestFood))
         return false;
@@ -357,21 +298,12 @@ static bool award_is_deserved_worst_food(int32_t activeAwardTypes)
         return false;
 
     // Count hungry peeps
-    auto hungryPeeps = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness <= 5 && thought.type == PeepThoughtType::Hungry)
-            hungryPeeps++;
-    }
+    auto hungryPeeps = guests.CountFreshThoughtsInPark()[EnumValue(PeepThoughtType::Hungry)];
     return (hungryPeeps > 15);
 }
 
 /** At least 4 restrooms, 1 restroom per 128 guests and no more than 16 guests who think they need the restroom. */
-static bool award_is_deserved_best_restrooms([[maybe_unused]] int32_t activeAwardTypes)
+static bool award_is_deserved_best_restrooms([[maybe_unused]] int32_t activeAwardTypes, const GuestHotFields& guests)
 {
     // Count open restrooms
     const auto& rideManager = GetRideManager();
@@ -388,21 +320,12 @@ static bool award_is_deserved_best_restrooms([[maybe_unused]] int32_t activeAwar
         return false;
 
     // Count number of guests who are thinking they need the restroom
-    auto guestsWhoNeedRestroom = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness <= 5 && thought.type == PeepThoughtType::Toilet)
-            guestsWhoNeedRestroom++;
-    }
+    auto guestsWhoNeedRestroom = guests.CountFreshThoughtsInPark()[EnumValue(PeepThoughtType::Toilet)];
     return (guestsWhoNeedRestroom <= 16);
 }
 
 /** More than half of the rides have satisfaction <= 6 and park rating <= 650. */
-static bool award_is_deserved_most_disappointing(int32_t activeAwardTypes)
+static bool award_is_deserved_most_disappointing(int32_t activeAwardTypes, [[maybe_unused]] const GuestHotFields& guests)
 {
     if (activeAwardTypes & EnumToFlag(AwardType::BestValue))
         return false;
@@ -429,7 +352,8 @@ static bool award_is_deserved_most_disappointing(int32_t activeAwardTypes)
 }
 
 /** At least 6 open water rides. */
-static bool award_is_deserved_best_water_rides([[maybe_unused]] int32_t activeAwardTypes)
+static bool award_is_deserved_best_water_rides(
+    [[maybe_unused]] int32_t activeAwardTypes, [[maybe_unused]] const GuestHotFields& guests)
 {
     auto waterRides = 0;
     for (const auto& ride : GetRideManager())
@@ -457,7 +381,8 @@ static bool award_is_deserved_best_water_rides([[maybe_unused]] int32_t activeAw
 }
 
 /** At least 6 custom designed rides. */
-static bool award_is_deserved_best_custom_designed_rides(int32_t activeAwardTypes)
+static bool award_is_deserved_best_custom_designed_rides(
+    int32_t activeAwardTypes, [[maybe_unused]] const GuestHotFields& guests)
 {
     if (activeAwardTypes & EnumToFlag(AwardType::MostDisappointing))
         return false;
@@ -480,7 +405,8 @@ static bool award_is_deserved_best_custom_designed_rides(int32_t activeAwardType
     return (customDesignedRides >= 6);
 }
 
-static bool award_is_deserved_most_dazzling_ride_colours(int32_t activeAwardTypes)
+static bool award_is_deserved_most_dazzling_ride_colours(
+    int32_t activeAwardTypes, [[maybe_unused]] const GuestHotFields& guests)
 {
     /** At least 5 colourful rides and more than half of the rides are colourful. */
     static constexpr const colour_t dazzling_ride_colours[] = {
@@ -517,26 +443,18 @@ static bool award_is_deserved_most_dazzling_ride_colours(int32_t activeAwardType
 }
 
 /** At least 10 peeps and more than 1/64 of total guests are lost or can't find something. */
-static bool award_is_deserved_most_confusing_layout([[maybe_unused]] int32_t activeAwardTypes)
+static bool award_is_deserved_most_confusing_layout([[maybe_unused]] int32_t activeAwardTypes, const GuestHotFields& guests)
 {
-    uint32_t peepsCounted = 0;
-    uint32_t peepsLost = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        peepsCounted++;
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness <= 5 && (thought.type == PeepThoughtType::Lost || thought.type == PeepThoughtType::CantFind))
-            peepsLost++;
-    }
+    const auto thoughts = guests.CountFreshThoughtsInPark();
+    uint32_t peepsCounted = guests.CountInPark();
+    uint32_t peepsLost = thoughts[EnumValue(PeepThoughtType::Lost)] + thoughts[EnumValue(PeepThoughtType::CantFind)];
 
     return (peepsLost >= 10 && peepsLost >= peepsCounted / 64);
 }
 
 /** At least 10 open gentle rides. */
-static bool award_is_deserved_best_gentle_rides([[maybe_unused]] int32_t activeAwardTypes)
+static bool award_is_deserved_best_gentle_rides(
+    [[maybe_unused]] int32_t activeAwardTypes, [[maybe_unused]] const GuestHotFields& guests)
 {
     auto gentleRides = 0;
     for (const auto& ride : GetRideManager())
@@ -563,7 +481,7 @@ static bool award_is_deserved_best_gentle_rides([[maybe_unused]] int32_t activeA
     return (gentleRides >= 10);
 }
 
-using award_deserved_check = bool (*)(int32_t);
+using award_deserved_check = bool (*)(int32_t, const GuestHotFields&);
 
 static constexpr const award_deserved_check _awardChecks[] = {
     award_is_deserved_most_untidy,
@@ -585,9 +503,9 @@ static constexpr const award_deserved_check _awardChecks[] = {
     award_is_deserved_best_gentle_rides,
 };
 
-static bool award_is_deserved(AwardType awardType, int32_t activeAwardTypes)
+static bool award_is_deserved(AwardType awardType, int32_t activeAwardTypes, const GuestHotFields& guests)
 {
-    return _awardChecks[EnumValue(awardType)](activeAwardTypes);
+    return _awardChecks[EnumValue(awardType)](activeAwardTypes, guests);
 }
 
 #pragma endregion
@@ -601,7 +519,7 @@ void award_reset()
  *
  *  rct2: 0x0066A86C
  */
-void award_update_all()
+void award_update_all(const GuestHotFields& guests)
 {
     PROFILED_FUNCTION();
 
@@ -626,7 +544,7 @@ void award_update_all()
             } while (activeAwardTypes & (1 << EnumValue(awardType)));
 
             // Check if award is deserved
-            if (award_is_deserved(awardType, activeAwardTypes))
+            if (award_is_deserved(awardType, activeAwardTypes, guests))
             {
                 // Add award
                 _currentAwards.push_back(Award{ 5u, awardType });
@@ -13,6 +13,8 @@
 
 #include <vector>
 
+struct GuestHotFields;
+
 enum class AwardType : uint16_t
 {
     MostUntidy,
@@ -46,4 +48,4 @@ std::vector<Award>& GetAwards();
 
 bool award_is_positive(AwardType type);
 void award_reset();
-void award_update_all();
+void award_update_all(const GuestHotFields& guests);
@@ -17,9 +17,11 @@
 #include "../actions/LoadOrQuitAction.h"
 #include "../actions/NetworkModifyGroupAction.h"
 #include "../actions/PeepPickupAction.h"
+#include "../core/Compression.h"
 #include "../core/File.h"
 #include "../core/Guard.hpp"
 #include "../core/Json.hpp"
+#include "../core/OrcaStream.hpp"
 #include "../entity/EntityList.h"
 #include "../entity/EntityRegistry.h"
 #include "../entity/EntityTweener.h"
@@ -36,13 +38,14 @@
 #include "network.h"
 
 #include <algorithm>
+#include <chrono>
 #include <iterator>
 #include <stdexcept>
 
 // This string specifies which version of network stream current build uses.
 // It is used for making sure only compatible builds get connected, even within
 // single OpenRCT2 version.
-#define NETWORK_STREAM_VERSION "21"
+#define NETWORK_STREAM_VERSION "23"
 #define NETWORK_STREAM_ID OPENRCT2_VERSION "-" NETWORK_STREAM_VERSION
 
 static Peep* _pickup_peep = nullptr;
@@ -194,6 +197,8 @@ void NetworkBase::Close()
         CloseServerLog();
         CloseConnection();
 
+        _pendingMapTransfers.clear();
+        InvalidateMapSnapshots();
         client_connection_list.clear();
         GameActions::ClearQueue();
         GameActions::ResumeQueue();
@@ -226,6 +231,9 @@ void NetworkBase::DecayCooldown(NetworkPlayer* player)
 
 void NetworkBase::CloseConnection()
 {
+    // Stop the I/O thread before any of its connections go away.
+    _ioThread.reset();
+
     if (mode == NETWORK_MODE_CLIENT)
     {
         _serverConnection.reset();
@@ -261,6 +269,10 @@ bool NetworkBase::BeginClient(const std::string& host, uint16_t port)
     _serverConnection = std::make_unique<NetworkConnection>();
     _serverConnection->Socket = CreateTcpSocket();
     _serverConnection->Socket->ConnectAsync(host, port);
+    if (gConfigNetwork.io_thread)
+    {
+        _ioThread = std::make_unique<NetworkIoThread>();
+    }
     _serverState.gamestateSnapshotsEnabled = false;
 
     status = NETWORK_STATUS_CONNECTING;
@@ -366,6 +378,11 @@ bool NetworkBase::BeginServer(uint16_t port, const std::string& address)
         return false;
     }
 
+    if (gConfigNetwork.io_thread)
+    {
+        _ioThread = std::make_unique<NetworkIoThread>();
+    }
+
     ServerName = gConfigNetwork.server_name;
     ServerDescription = gConfigNetwork.server_description;
     ServerGreeting = gConfigNetwork.server_greeting;
@@ -497,6 +514,11 @@ void NetworkBase::Flush()
             it->SendQueuedPackets();
         }
     }
+
+    if (_ioThread != nullptr)
+    {
+        _ioThread->Wake();
+    }
 }
 
 void NetworkBase::UpdateServer()
@@ -524,6 +546,8 @@ void NetworkBase::UpdateServer()
         Server_Send_PINGLIST();
     }
 
+    ProcessPendingMapTransfers();
+
     if (_advertiser != nullptr)
     {
         _advertiser->Update();
@@ -582,6 +606,10 @@ void NetworkBase::UpdateClient()
                 {
                     status = NETWORK_STATUS_CONNECTED;
                     _serverConnection->ResetLastPacketTime();
+                    if (_ioThread != nullptr)
+                    {
+                        _ioThread->AddConnection(*_serverConnection);
+                    }
                     Client_Send_TOKEN();
                     char str_authenticating[256];
                     format_string(str_authenticating, 256, STR_MULTIPLAYER_AUTHENTICATING, nullptr);
@@ -702,8 +730,10 @@ const char* NetworkBase::FormatChat(NetworkPlayer* fromplayer, const char* text)
     return formatted.c_str();
 }
 
-void NetworkBase::SendPacketToClients(const NetworkPacket& packet, bool front, bool gameCmd) const
+void NetworkBase::SendPacketToClients(NetworkPacket&& packet, bool front, bool gameCmd) const
 {
+    // Every connection queues the same packet, the payload is not copied per client.
+    auto sharedPacket = std::make_shared<const NetworkPacket>(std::move(packet));
     for (auto& client_connection : client_connection_list)
     {
         if (gameCmd)
@@ -717,7 +747,7 @@ void NetworkBase::SendPacketToClients(const NetworkPacket& packet, bool front, b
                 continue;
             }
         }
-        client_connection->QueuePacket(packet, front);
+        client_connection->QueuePacket(sharedPacket, front);
     }
 }
 
@@ -1314,17 +1344,20 @@ NetworkStats_t NetworkBase::GetStats() const
     NetworkStats_t stats = {};
     if (mode == NETWORK_MODE_CLIENT)
     {
-        stats = _serverConnection->Stats;
+        stats = _serverConnection->GetStats();
     }
     else
     {
         for (auto& connection : client_connection_list)
         {
+            const auto connectionStats = connection->GetStats();
             for (size_t n = 0; n < EnumValue(NetworkStatisticsGroup::Max); n++)
             {
-                stats.bytesReceived[n] += connection->Stats.bytesReceived[n];
-                stats.bytesSent[n] += connection->Stats.bytesSent[n];
+                stats.bytesReceived[n] += connectionStats.bytesReceived[n];
+                stats.bytesSent[n] += connectionStats.bytesSent[n];
             }
+            stats.bytesCopied += connectionStats.bytesCopied;
+            stats.sendCalls += connectionStats.sendCalls;
         }
     }
     return stats;
@@ -1364,10 +1397,13 @@ void NetworkBase::Server_Send_MAP(NetworkConnection* connection)
         auto& context = GetContext();
         auto& objManager = context.GetObjectManager();
         objects = objManager.GetPackableObjects();
+
+        // The map is sent to everyone when the park changed, any earlier snapshot is out of date.
+        InvalidateMapSnapshots();
     }
 
-    auto header = save_for_network(objects);
-    if (header.empty())
+    auto snapshot = GetMapSnapshot(std::move(objects));
+    if (snapshot == nullptr)
     {
         if (connection != nullptr)
         {
@@ -1376,38 +1412,130 @@ void NetworkBase::Server_Send_MAP(NetworkConnection* connection)
         }
         return;
     }
-    size_t chunksize = CHUNK_SIZE;
-    for (size_t i = 0; i < header.size(); i += chunksize)
+
+    // The map packets are queued once the snapshot has been compressed, anything sent in the meantime is held back
+    // so that it still arrives after the map.
+    if (connection != nullptr)
     {
-        size_t datasize = std::min(chunksize, header.size() - i);
-        NetworkPacket packet(NetworkCommand::Map);
-        packet << static_cast<uint32_t>(header.size()) << static_cast<uint32_t>(i);
-        packet.Write(&header[i], datasize);
-        if (connection != nullptr)
-        {
-            connection->QueuePacket(std::move(packet));
-        }
-        else
+        connection->HoldPackets();
+        _pendingMapTransfers.push_back({ connection, snapshot });
+    }
+    else
+    {
+        for (auto& clientConnection : client_connection_list)
         {
-            SendPacketToClients(packet);
+            if (clientConnection->AuthStatus == NetworkAuth::Ok)
+            {
+                clientConnection->HoldPackets();
+                _pendingMapTransfers.push_back({ clientConnection.get(), snapshot });
+            }
         }
     }
 }
 
-std::vector<uint8_t> NetworkBase::save_for_network(const std::vector<const ObjectRepositoryItem*>& objects) const
+std::shared_ptr<NetworkMapSnapshot> NetworkBase::GetMapSnapshot(std::vector<const ObjectRepositoryItem*> objects)
 {
-    std::vector<uint8_t> result;
-    auto ms = OpenRCT2::MemoryStream();
-    if (SaveMap(&ms, objects))
+    std::sort(objects.begin(), objects.end());
+
+    // Snapshots can only be shared by clients joining on the same tick.
+    _mapSnapshots.erase(
+        std::remove_if(
+            _mapSnapshots.begin(), _mapSnapshots.end(),
+            [](const std::shared_ptr<NetworkMapSnapshot>& s) { return s->Tick != gCurrentTicks; }),
+        _mapSnapshots.end());
+
+    auto it = std::find_if(_mapSnapshots.begin(), _mapSnapshots.end(), [&objects](const auto& s) {
+        return s->Objects == objects;
+    });
+    if (it != _mapSnapshots.end())
     {
-        result.resize(ms.GetLength());
-        std::memcpy(result.data(), ms.GetData(), result.size());
+        return *it;
     }
-    else
+
+    // Serialising reads the game state so has to happen here, compressing it is left to a background thread.
+    auto uncompressed = std::make_shared<OpenRCT2::MemoryStream>();
+    if (!SaveMap(uncompressed.get(), objects, false))
     {
         log_warning("Failed to export map.");
+        return nullptr;
+    }
+
+    auto snapshot = std::make_shared<NetworkMapSnapshot>();
+    snapshot->Tick = gCurrentTicks;
+    snapshot->Objects = std::move(objects);
+    // Always gzip, clients have no way to tell the server which codecs they support.
+    auto compress = [uncompressed]() {
+        std::vector<uint8_t> result;
+        try
+        {
+            auto ms = OpenRCT2::MemoryStream();
+            uncompressed->SetPosition(0);
+            OrcaStream::Recompress(*uncompressed, ms, CompressionType::Gzip);
+            const auto* data = static_cast<const uint8_t*>(ms.GetData());
+            result.assign(data, data + ms.GetLength());
+        }
+        catch (const std::exception& e)
+        {
+            log_warning("Failed to compress map: %s", e.what());
+        }
+        return result;
+    };
+    snapshot->Data = std::async(std::launch::async, std::move(compress)).share();
+    _mapSnapshots.push_back(snapshot);
+    return snapshot;
+}
+
+void NetworkBase::InvalidateMapSnapshots()
+{
+    // Transfers that are still pending keep their snapshot alive.
+    _mapSnapshots.clear();
+}
+
+void NetworkBase::ProcessPendingMapTransfers()
+{
+    for (auto it = _pendingMapTransfers.begin(); it != _pendingMapTransfers.end();)
+    {
+        if (it->Snapshot->Data.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        {
+            it++;
+            continue;
+        }
+
+        auto* connection = it->Connection;
+        auto snapshot = std::move(it->Snapshot);
+        const auto& map = snapshot->Data.get();
+        it = _pendingMapTransfers.erase(it);
+        if (map.empty())
+        {
+            connection->ReleaseHeldPackets();
+            connection->SetLastDisconnectReason(STR_MULTIPLAYER_CONNECTION_CLOSED);
+            connection->Disconnect();
+            continue;
+        }
+
+        auto held = connection->ReleaseHeldPackets();
+        for (size_t i = 0; i < map.size(); i += CHUNK_SIZE)
+        {
+            size_t datasize = std::min<size_t>(CHUNK_SIZE, map.size() - i);
+            NetworkPacket packet(NetworkCommand::Map);
+            packet << static_cast<uint32_t>(map.size()) << static_cast<uint32_t>(i);
+            packet.Write(&map[i], datasize);
+            connection->QueuePacket(std::move(packet));
+        }
+
+        // Another map may have been requested for this connection in the meantime.
+        auto hasOtherTransfer = std::any_of(
+            _pendingMapTransfers.begin(), _pendingMapTransfers.end(),
+            [connection](const PendingMapTransfer& t) { return t.Connection == connection; });
+        if (hasOtherTransfer)
+        {
+            connection->HoldPackets();
+        }
+        for (auto& packet : held)
+        {
+            connection->QueuePacket(std::move(packet));
+        }
     }
-    return result;
 }
 
 void NetworkBase::Client_Send_CHAT(const char* text)
@@ -1425,16 +1553,17 @@ void NetworkBase::Server_Send_CHAT(const char* text, const std::vector<uint8_t>&
     if (playerIds.empty())
     {
         // Empty players / default value means send to all players
-        SendPacketToClients(packet);
+        SendPacketToClients(std::move(packet));
     }
     else
     {
+        auto sharedPacket = std::make_shared<const NetworkPacket>(std::move(packet));
         for (auto playerId : playerIds)
         {
             auto conn = GetPlayerConnection(playerId);
             if (conn != nullptr)
             {
-                conn->QueuePacket(packet);
+                conn->QueuePacket(sharedPacket);
             }
         }
     }
@@ -1463,6 +1592,9 @@ void NetworkBase::Client_Send_GAME_ACTION(const GameAction* action)
 
 void NetworkBase::Server_Send_GAME_ACTION(const GameAction* action)
 {
+    // Actions can run while paused without the tick advancing, so snapshots of this tick may no longer match.
+    InvalidateMapSnapshots();
+
     NetworkPacket packet(NetworkCommand::GameAction);
 
     DataSerialiser stream(true);
@@ -1470,7 +1602,7 @@ void NetworkBase::Server_Send_GAME_ACTION(const GameAction* action)
 
     packet << gCurrentTicks << action->GetType() << stream;
 
-    SendPacketToClients(packet);
+    SendPacketToClients(std::move(packet));
 }
 
 void NetworkBase::Server_Send_TICK()
@@ -1497,7 +1629,7 @@ void NetworkBase::Server_Send_TICK()
         packet.WriteString(checksum.ToString());
     }
 
-    SendPacketToClients(packet);
+    SendPacketToClients(std::move(packet));
 }
 
 void NetworkBase::Server_Send_PLAYERINFO(int32_t playerId)
@@ -1510,7 +1642,7 @@ void NetworkBase::Server_Send_PLAYERINFO(int32_t playerId)
         return;
 
     player->Write(packet);
-    SendPacketToClients(packet);
+    SendPacketToClients(std::move(packet));
 }
 
 void NetworkBase::Server_Send_PLAYERLIST()
@@ -1521,7 +1653,7 @@ void NetworkBase::Server_Send_PLAYERLIST()
     {
         player->Write(packet);
     }
-    SendPacketToClients(packet);
+    SendPacketToClients(std::move(packet));
 }
 
 void NetworkBase::Client_Send_PING()
@@ -1538,7 +1670,7 @@ void NetworkBase::Server_Send_PING()
     {
         client_connection->PingTime = Platform::GetTicks();
     }
-    SendPacketToClients(packet, true);
+    SendPacketToClients(std::move(packet), true);
 }
 
 void NetworkBase::Server_Send_PINGLIST()
@@ -1549,7 +1681,7 @@ void NetworkBase::Server_Send_PINGLIST()
     {
         packet << player->Id << player->Ping;
     }
-    SendPacketToClients(packet);
+    SendPacketToClients(std::move(packet));
 }
 
 void NetworkBase::Server_Send_SETDISCONNECTMSG(NetworkConnection& connection, const char* msg)
@@ -1615,7 +1747,7 @@ void NetworkBase::Server_Send_EVENT_PLAYER_JOINED(const char* playerName)
     NetworkPacket packet(NetworkCommand::Event);
     packet << static_cast<uint16_t>(SERVER_EVENT_PLAYER_JOINED);
     packet.WriteString(playerName);
-    SendPacketToClients(packet);
+    SendPacketToClients(std::move(packet));
 }
 
 void NetworkBase::Server_Send_EVENT_PLAYER_DISCONNECTED(const char* playerName, const char* reason)
@@ -1624,7 +1756,7 @@ void NetworkBase::Server_Send_EVENT_PLAYER_DISCONNECTED(const char* playerName,
     packet << static_cast<uint16_t>(SERVER_EVENT_PLAYER_DISCONNECTED);
     packet.WriteString(playerName);
     packet.WriteString(reason);
-    SendPacketToClients(packet);
+    SendPacketToClients(std::move(packet));
 }
 
 bool NetworkBase::ProcessConnection(NetworkConnection& connection)
@@ -1907,6 +2039,11 @@ void NetworkBase::ProcessDisconnectedClients()
             continue;
         }
 
+        if (_ioThread != nullptr)
+        {
+            _ioThread->RemoveConnection(*connection);
+        }
+
         // Make sure to send all remaining packets out before disconnecting.
         connection->SendQueuedPackets();
         connection->Socket->Disconnect();
@@ -1914,6 +2051,11 @@ void NetworkBase::ProcessDisconnectedClients()
         ServerClientDisconnected(connection);
         RemovePlayer(connection);
 
+        _pendingMapTransfers.erase(
+            std::remove_if(
+                _pendingMapTransfers.begin(), _pendingMapTransfers.end(),
+                [&connection](const PendingMapTransfer& t) { return t.Connection == connection.get(); }),
+            _pendingMapTransfers.end());
         it = client_connection_list.erase(it);
     }
 }
@@ -1928,6 +2070,10 @@ void NetworkBase::AddClient(std::unique_ptr<ITcpSocket>&& socket)
     // Store connection
     auto connection = std::make_unique<NetworkConnection>();
     connection->Socket = std::move(socket);
+    if (_ioThread != nullptr)
+    {
+        _ioThread->AddConnection(*connection);
+    }
 
     client_connection_list.push_back(std::move(connection));
 }
@@ -2743,7 +2889,7 @@ bool NetworkBase::LoadMap(IStream* stream)
     return result;
 }
 
-bool NetworkBase::SaveMap(IStream* stream, const std::vector<const ObjectRepositoryItem*>& objects) const
+bool NetworkBase::SaveMap(IStream* stream, const std::vector<const ObjectRepositoryItem*>& objects, bool compress) const
 {
     bool result = false;
     PrepareMapForSave();
@@ -2751,6 +2897,10 @@ bool NetworkBase::SaveMap(IStream* stream, const std::vector<const ObjectReposit
     {
         auto exporter = std::make_unique<ParkFileExporter>();
         exporter->ExportObjectsList = objects;
+        if (!compress)
+        {
+            exporter->SaveCompression = CompressionType::None;
+        }
         exporter->Export(*stream);
         result = true;
     }
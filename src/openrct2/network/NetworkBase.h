@@ -5,12 +5,15 @@
 #include "../object/Object.h"
 #include "NetworkConnection.h"
 #include "NetworkGroup.h"
+#include "NetworkIoThread.h"
 #include "NetworkPlayer.h"
 #include "NetworkServerAdvertiser.h"
 #include "NetworkTypes.h"
 #include "NetworkUser.h"
 
 #include <fstream>
+#include <future>
+#include <memory>
 
 #ifndef DISABLE_NETWORK
 
@@ -19,6 +22,17 @@ namespace OpenRCT2
     struct IContext;
 }
 
+/**
+ * A serialised map shared by all clients that join on the same tick and request the same objects.
+ * The park is serialised on the game thread, Data completes once it has been compressed.
+ */
+struct NetworkMapSnapshot
+{
+    uint32_t Tick{};
+    std::vector<const ObjectRepositoryItem*> Objects;
+    std::shared_future<std::vector<uint8_t>> Data;
+};
+
 class NetworkBase : public OpenRCT2::System
 {
 public:
@@ -75,8 +89,11 @@ public: // Server
     void RemovePlayer(std::unique_ptr<NetworkConnection>& connection);
     void UpdateServer();
     void ServerClientDisconnected(std::unique_ptr<NetworkConnection>& connection);
-    bool SaveMap(OpenRCT2::IStream* stream, const std::vector<const ObjectRepositoryItem*>& objects) const;
-    std::vector<uint8_t> save_for_network(const std::vector<const ObjectRepositoryItem*>& objects) const;
+    bool SaveMap(
+        OpenRCT2::IStream* stream, const std::vector<const ObjectRepositoryItem*>& objects, bool compress = true) const;
+    std::shared_ptr<NetworkMapSnapshot> GetMapSnapshot(std::vector<const ObjectRepositoryItem*> objects);
+    void InvalidateMapSnapshots();
+    void ProcessPendingMapTransfers();
     std::string MakePlayerNameUnique(const std::string& name);
 
     // Packet dispatchers.
@@ -120,7 +137,7 @@ public: // Client
     void ProcessPlayerInfo();
     void ProcessDisconnectedClients();
     static const char* FormatChat(NetworkPlayer* fromplayer, const char* text);
-    void SendPacketToClients(const NetworkPacket& packet, bool front = false, bool gameCmd = false) const;
+    void SendPacketToClients(NetworkPacket&& packet, bool front = false, bool gameCmd = false) const;
     bool CheckSRAND(uint32_t tick, uint32_t srand0);
     bool CheckDesynchronizaton();
     void RequestStateSnapshot();
@@ -189,6 +206,7 @@ private: // Common Data
     bool _closeLock = false;
     bool _requireClose = false;
     bool wsa_initialized = false;
+    std::unique_ptr<NetworkIoThread> _ioThread;
 
 private: // Server Data
     std::unordered_map<NetworkCommand, CommandHandler> server_command_handlers;
@@ -201,6 +219,14 @@ private: // Server Data
     uint16_t listening_port = 0;
     bool _playerListInvalidated = false;
 
+    struct PendingMapTransfer
+    {
+        NetworkConnection* Connection{};
+        std::shared_ptr<NetworkMapSnapshot> Snapshot;
+    };
+    std::vector<std::shared_ptr<NetworkMapSnapshot>> _mapSnapshots;
+    std::vector<PendingMapTransfer> _pendingMapTransfers;
+
 private: // Client Data
     struct PlayerListUpdate
     {
@@ -17,25 +17,60 @@
 #    include "Socket.h"
 #    include "network.h"
 
+#    include <utility>
+
 constexpr size_t NETWORK_DISCONNECT_REASON_BUFFER_SIZE = 256;
 constexpr size_t NetworkBufferSize = 1024 * 64; // 64 KiB, maximum packet size.
 
-NetworkConnection::NetworkConnection() noexcept
+// Packets that can be waiting to be handed between the game thread and the network I/O thread, per direction.
+constexpr size_t NetworkIoQueueSize = 1024;
+
+// Packets read per connection in one pass of the network I/O thread.
+constexpr size_t NetworkIoMaxPacketsPerPass = 100;
+
+NetworkConnection::NetworkConnection()
+    : _ioReceivedPackets(NetworkIoQueueSize)
+    , _ioSendPackets(NetworkIoQueueSize)
 {
     ResetLastPacketTime();
 }
 
 NetworkReadPacket NetworkConnection::ReadPacket()
+{
+    NetworkReadPacket status;
+    if (_servicedByIoThread)
+    {
+        if (_ioReceivedPackets.TryPop(InboundPacket))
+            status = NetworkReadPacket::Success;
+        else
+            status = _ioDisconnected ? NetworkReadPacket::Disconnected : NetworkReadPacket::NoData;
+    }
+    else
+    {
+        status = ReceivePacket(InboundPacket);
+    }
+
+    if (status == NetworkReadPacket::Success)
+    {
+        _lastPacketTime = Platform::GetTicks();
+
+        std::lock_guard<std::mutex> lock(_statsMutex);
+        RecordPacketStats(InboundPacket.GetCommand(), InboundPacket.BytesTransferred, false);
+    }
+    return status;
+}
+
+NetworkReadPacket NetworkConnection::ReceivePacket(NetworkPacket& packet)
 {
     size_t bytesRead = 0;
 
     // Read packet header.
-    auto& header = InboundPacket.Header;
-    if (InboundPacket.BytesTransferred < sizeof(InboundPacket.Header))
+    auto& header = packet.Header;
+    if (packet.BytesTransferred < sizeof(packet.Header))
     {
-        const size_t missingLength = sizeof(header) - InboundPacket.BytesTransferred;
+        const size_t missingLength = sizeof(header) - packet.BytesTransferred;
 
-        uint8_t* buffer = reinterpret_cast<uint8_t*>(&InboundPacket.Header);
+        uint8_t* buffer = reinterpret_cast<uint8_t*>(&packet.Header);
 
         NetworkReadPacket status = Socket->ReceiveData(buffer, missingLength, &bytesRead);
         if (status != NetworkReadPacket::Success)
@@ -43,8 +78,8 @@ NetworkReadPacket NetworkConnection::ReadPacket()
             return status;
         }
 
-        InboundPacket.BytesTransferred += bytesRead;
-        if (InboundPacket.BytesTransferred < sizeof(InboundPacket.Header))
+        packet.BytesTransferred += bytesRead;
+        if (packet.BytesTransferred < sizeof(packet.Header))
         {
             // If still not enough data for header, keep waiting.
             return NetworkReadPacket::MoreData;
@@ -64,7 +99,7 @@ NetworkReadPacket NetworkConnection::ReadPacket()
     // Read packet body.
     {
         // NOTE: BytesTransfered includes the header length, this will not underflow.
-        const size_t missingLength = header.Size - (InboundPacket.BytesTransferred - sizeof(header));
+        const size_t missingLength = header.Size - (packet.BytesTransferred - sizeof(header));
 
         uint8_t buffer[NetworkBufferSize];
 
@@ -76,17 +111,13 @@ NetworkReadPacket NetworkConnection::ReadPacket()
                 return status;
             }
 
-            InboundPacket.BytesTransferred += bytesRead;
-            InboundPacket.Write(buffer, bytesRead);
+            packet.BytesTransferred += bytesRead;
+            packet.Write(buffer, bytesRead);
         }
 
-        if (InboundPacket.Data.size() == header.Size)
+        if (packet.Data.size() == header.Size)
         {
             // Received complete packet.
-            _lastPacketTime = Platform::GetTicks();
-
-            RecordPacketStats(InboundPacket, false);
-
             return NetworkReadPacket::Success;
         }
     }
@@ -94,55 +125,62 @@ NetworkReadPacket NetworkConnection::ReadPacket()
     return NetworkReadPacket::MoreData;
 }
 
-bool NetworkConnection::SendPacket(NetworkPacket& packet)
+static void AppendPacket(std::vector<uint8_t>& buffer, const NetworkPacket& packet)
 {
-    auto header = packet.Header;
-
-    std::vector<uint8_t> buffer;
-    buffer.reserve(sizeof(header) + header.Size);
+    PacketHeader header = packet.Header;
 
     // NOTE: For compatibility reasons for the master server we need to add sizeof(Header.Id) to the size.
     // Previously the Id field was not part of the header rather part of the body.
-    header.Size += sizeof(header.Id);
+    header.Size = static_cast<uint16_t>(packet.Data.size() + sizeof(header.Id));
     header.Size = Convert::HostToNetwork(header.Size);
     header.Id = ByteSwapBE(header.Id);
 
     buffer.insert(buffer.end(), reinterpret_cast<uint8_t*>(&header), reinterpret_cast<uint8_t*>(&header) + sizeof(header));
     buffer.insert(buffer.end(), packet.Data.begin(), packet.Data.end());
+}
 
-    size_t bufferSize = buffer.size() - packet.BytesTransferred;
-    size_t sent = Socket->SendData(buffer.data() + packet.BytesTransferred, bufferSize);
-    if (sent > 0)
-    {
-        packet.BytesTransferred += sent;
-    }
+void NetworkConnection::PackQueuedPackets(std::deque<NetworkSharedPacket>& packets)
+{
+    _sendBuffer.clear();
+    _sendBufferOffset = 0;
 
-    bool sendComplete = packet.BytesTransferred == buffer.size();
-    if (sendComplete)
+    size_t bytesCopied = 0;
+    while (!packets.empty())
     {
-        RecordPacketStats(packet, true);
+        const auto& packet = *packets.front();
+        const auto packetSize = sizeof(PacketHeader) + packet.Data.size();
+        if (!_sendBuffer.empty() && _sendBuffer.size() + packetSize > NetworkBufferSize)
+        {
+            break;
+        }
+
+        AppendPacket(_sendBuffer, packet);
+        _sendBufferPackets.push_back({ packet.GetCommand(), packetSize, _sendBuffer.size() });
+        bytesCopied += packetSize;
+        packets.pop_front();
     }
-    return sendComplete;
+
+    std::lock_guard<std::mutex> lock(_statsMutex);
+    _stats.bytesCopied += bytesCopied;
 }
 
 void NetworkConnection::QueuePacket(NetworkPacket&& packet, bool front)
 {
-    if (AuthStatus == NetworkAuth::Ok || !packet.CommandRequiresAuth())
+    QueuePacket(std::make_shared<const NetworkPacket>(std::move(packet)), front);
+}
+
+void NetworkConnection::QueuePacket(NetworkSharedPacket packet, bool front)
+{
+    if (AuthStatus == NetworkAuth::Ok || !packet->CommandRequiresAuth())
     {
-        packet.Header.Size = static_cast<uint16_t>(packet.Data.size());
+        // Packets that have been packed are already being sent, so the front of the queue is the next packet to pack.
         if (front)
         {
-            // If the first packet was already partially sent add new packet to second position
-            if (!_outboundPackets.empty() && _outboundPackets.front().BytesTransferred > 0)
-            {
-                auto it = _outboundPackets.begin();
-                it++; // Second position
-                _outboundPackets.insert(it, std::move(packet));
-            }
-            else
-            {
-                _outboundPackets.push_front(std::move(packet));
-            }
+            _outboundPackets.push_front(std::move(packet));
+        }
+        else if (_holdPackets)
+        {
+            _heldPackets.push_back(std::move(packet));
         }
         else
         {
@@ -151,6 +189,17 @@ void NetworkConnection::QueuePacket(NetworkPacket&& packet, bool front)
     }
 }
 
+void NetworkConnection::HoldPackets() noexcept
+{
+    _holdPackets = true;
+}
+
+std::deque<NetworkSharedPacket> NetworkConnection::ReleaseHeldPackets() noexcept
+{
+    _holdPackets = false;
+    return std::exchange(_heldPackets, {});
+}
+
 void NetworkConnection::Disconnect() noexcept
 {
     ShouldDisconnect = true;
@@ -163,9 +212,111 @@ bool NetworkConnection::IsValid() const
 
 void NetworkConnection::SendQueuedPackets()
 {
-    while (!_outboundPackets.empty() && SendPacket(_outboundPackets.front()))
+    if (_servicedByIoThread)
+    {
+        while (!_outboundPackets.empty() && _ioSendPackets.TryPush(_outboundPackets.front()))
+        {
+            _outboundPackets.pop_front();
+        }
+        return;
+    }
+
+    SendPackets(_outboundPackets);
+}
+
+void NetworkConnection::SendPackets(std::deque<NetworkSharedPacket>& packets)
+{
+    for (;;)
     {
-        _outboundPackets.pop_front();
+        if (_sendBufferOffset == _sendBuffer.size())
+        {
+            if (packets.empty())
+                break;
+
+            PackQueuedPackets(packets);
+        }
+
+        const size_t bufferSize = _sendBuffer.size() - _sendBufferOffset;
+        const size_t sent = Socket->SendData(_sendBuffer.data() + _sendBufferOffset, bufferSize);
+        _sendBufferOffset += sent;
+
+        std::lock_guard<std::mutex> lock(_statsMutex);
+        _stats.sendCalls++;
+        while (!_sendBufferPackets.empty() && _sendBufferPackets.front().End <= _sendBufferOffset)
+        {
+            const auto& packed = _sendBufferPackets.front();
+            RecordPacketStats(packed.Command, packed.Size, true);
+            _sendBufferPackets.pop_front();
+        }
+
+        if (sent < bufferSize)
+            break;
+    }
+}
+
+void NetworkConnection::SetServicedByIoThread(bool serviced)
+{
+    if (!serviced && _servicedByIoThread)
+    {
+        // Put back everything the I/O thread has not packed yet, ahead of the packets queued since.
+        NetworkSharedPacket packet;
+        while (_ioSendPackets.TryPop(packet))
+        {
+            _ioOutboundPackets.push_back(std::move(packet));
+        }
+        _outboundPackets.insert(_outboundPackets.begin(), _ioOutboundPackets.begin(), _ioOutboundPackets.end());
+        _ioOutboundPackets.clear();
+    }
+    _servicedByIoThread = serviced;
+}
+
+bool NetworkConnection::IsServicedByIoThread() const noexcept
+{
+    return _servicedByIoThread;
+}
+
+void NetworkConnection::UpdateIo()
+{
+    if (_ioDisconnected)
+        return;
+
+    try
+    {
+        NetworkSharedPacket packet;
+        while (_ioSendPackets.TryPop(packet))
+        {
+            _ioOutboundPackets.push_back(std::move(packet));
+        }
+        SendPackets(_ioOutboundPackets);
+
+        for (size_t i = 0; i < NetworkIoMaxPacketsPerPass; i++)
+        {
+            if (!_ioInboundPacketComplete)
+            {
+                auto status = ReceivePacket(_ioInboundPacket);
+                if (status == NetworkReadPacket::Disconnected)
+                {
+                    _ioDisconnected = true;
+                    break;
+                }
+                if (status != NetworkReadPacket::Success)
+                    break;
+
+                _ioInboundPacketComplete = true;
+            }
+
+            // Stop reading while the game thread has not caught up.
+            if (!_ioReceivedPackets.TryPush(_ioInboundPacket))
+                break;
+
+            _ioInboundPacket = NetworkPacket();
+            _ioInboundPacketComplete = false;
+        }
+    }
+    catch (const std::exception& e)
+    {
+        log_verbose("Network I/O failed: %s", e.what());
+        _ioDisconnected = true;
     }
 }
 
@@ -202,12 +353,19 @@ void NetworkConnection::SetLastDisconnectReason(const rct_string_id string_id, v
     SetLastDisconnectReason(buffer);
 }
 
-void NetworkConnection::RecordPacketStats(const NetworkPacket& packet, bool sending)
+NetworkStats_t NetworkConnection::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(_statsMutex);
+    return _stats;
+}
+
+// Must be called with _statsMutex held.
+void NetworkConnection::RecordPacketStats(NetworkCommand command, size_t size, bool sending)
 {
-    uint32_t packetSize = static_cast<uint32_t>(packet.BytesTransferred);
+    uint32_t packetSize = static_cast<uint32_t>(size);
     NetworkStatisticsGroup trafficGroup;
 
-    switch (packet.GetCommand())
+    switch (command)
     {
         case NetworkCommand::GameAction:
             trafficGroup = NetworkStatisticsGroup::Commands;
@@ -222,13 +380,13 @@ void NetworkConnection::RecordPacketStats(const NetworkPacket& packet, bool send
 
     if (sending)
     {
-        Stats.bytesSent[EnumValue(trafficGroup)] += packetSize;
-        Stats.bytesSent[EnumValue(NetworkStatisticsGroup::Total)] += packetSize;
+        _stats.bytesSent[EnumValue(trafficGroup)] += packetSize;
+        _stats.bytesSent[EnumValue(NetworkStatisticsGroup::Total)] += packetSize;
     }
     else
     {
-        Stats.bytesReceived[EnumValue(trafficGroup)] += packetSize;
-        Stats.bytesReceived[EnumValue(NetworkStatisticsGroup::Total)] += packetSize;
+        _stats.bytesReceived[EnumValue(trafficGroup)] += packetSize;
+        _stats.bytesReceived[EnumValue(NetworkStatisticsGroup::Total)] += packetSize;
     }
 }
 
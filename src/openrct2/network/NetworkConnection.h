@@ -11,13 +11,16 @@
 
 #ifndef DISABLE_NETWORK
 #    include "../common.h"
+#    include "../core/SpscQueue.hpp"
 #    include "NetworkKey.h"
 #    include "NetworkPacket.h"
 #    include "NetworkTypes.h"
 #    include "Socket.h"
 
+#    include <atomic>
 #    include <deque>
 #    include <memory>
+#    include <mutex>
 #    include <string_view>
 #    include <vector>
 
@@ -30,7 +33,6 @@ public:
     std::unique_ptr<ITcpSocket> Socket = nullptr;
     NetworkPacket InboundPacket;
     NetworkAuth AuthStatus = NetworkAuth::None;
-    NetworkStats_t Stats = {};
     NetworkPlayer* Player = nullptr;
     uint32_t PingTime = 0;
     NetworkKey Key;
@@ -38,36 +40,74 @@ public:
     std::vector<const ObjectRepositoryItem*> RequestedObjects;
     bool ShouldDisconnect = false;
 
-    NetworkConnection() noexcept;
+    NetworkConnection();
 
     NetworkReadPacket ReadPacket();
     void QueuePacket(NetworkPacket&& packet, bool front = false);
-    void QueuePacket(const NetworkPacket& packet, bool front = false)
-    {
-        auto copy = packet;
-        return QueuePacket(std::move(copy), front);
-    }
+    void QueuePacket(NetworkSharedPacket packet, bool front = false);
 
     // This will not immediately disconnect the client. The disconnect
     // will happen post-tick.
     void Disconnect() noexcept;
 
+    // Packets queued while holding, other than those sent to the front, are kept back until
+    // released. Used to make sure the map arrives before anything queued while it was prepared.
+    void HoldPackets() noexcept;
+    std::deque<NetworkSharedPacket> ReleaseHeldPackets() noexcept;
+
     bool IsValid() const;
     void SendQueuedPackets();
     void ResetLastPacketTime() noexcept;
     bool ReceivedPacketRecently() const noexcept;
+    NetworkStats_t GetStats() const;
+
+    // While serviced by the network I/O thread, the socket is only read and written by UpdateIo. ReadPacket then
+    // returns the packets it has received and SendQueuedPackets hands the queued packets over to it. A connection
+    // keeps being serviced until it is closed, stopping only gives the outbound packets back for a final send.
+    void SetServicedByIoThread(bool serviced);
+    bool IsServicedByIoThread() const noexcept;
+    void UpdateIo();
 
     const utf8* GetLastDisconnectReason() const noexcept;
     void SetLastDisconnectReason(std::string_view src);
     void SetLastDisconnectReason(const rct_string_id string_id, void* args = nullptr);
 
 private:
-    std::deque<NetworkPacket> _outboundPackets;
+    struct PackedPacket
+    {
+        NetworkCommand Command;
+        size_t Size;
+        size_t End;
+    };
+
+    std::deque<NetworkSharedPacket> _outboundPackets;
+    std::deque<NetworkSharedPacket> _heldPackets;
+    bool _holdPackets = false;
     uint32_t _lastPacketTime = 0;
     std::string _lastDisconnectReason;
 
-    void RecordPacketStats(const NetworkPacket& packet, bool sending);
-    bool SendPacket(NetworkPacket& packet);
+    // Queued packets are packed together into one buffer so that each flush sends them with a single call.
+    std::vector<uint8_t> _sendBuffer;
+    size_t _sendBufferOffset = 0;
+    std::deque<PackedPacket> _sendBufferPackets;
+
+    // Written by whichever thread sends or receives.
+    mutable std::mutex _statsMutex;
+    NetworkStats_t _stats = {};
+
+    // Owned by the network I/O thread while the connection is serviced by it.
+    bool _servicedByIoThread = false;
+    NetworkPacket _ioInboundPacket;
+    bool _ioInboundPacketComplete = false;
+    std::deque<NetworkSharedPacket> _ioOutboundPackets;
+    std::atomic<bool> _ioDisconnected{ false };
+    OpenRCT2::SpscQueue<NetworkPacket> _ioReceivedPackets;
+    OpenRCT2::SpscQueue<NetworkSharedPacket> _ioSendPackets;
+
+    NetworkReadPacket ReceivePacket(NetworkPacket& packet);
+    void RecordPacketStats(NetworkCommand command, size_t size, bool sending);
+    void PackQueuedPackets(std::deque<NetworkSharedPacket>& packets);
+    void SendPackets(std::deque<NetworkSharedPacket>& packets);
 };
 
 #endif // DISABLE_NETWORK
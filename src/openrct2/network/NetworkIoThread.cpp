@@ -0,0 +1,85 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2022 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifndef DISABLE_NETWORK
+
+#    include "NetworkIoThread.h"
+
+#    include "NetworkConnection.h"
+
+#    include <algorithm>
+#    include <chrono>
+
+// The sockets are polled, this is the longest a received packet waits for the thread to wake up.
+constexpr auto NetworkIoPollInterval = std::chrono::milliseconds(1);
+
+NetworkIoThread::NetworkIoThread()
+{
+    _thread = std::thread([this] { Run(); });
+}
+
+NetworkIoThread::~NetworkIoThread()
+{
+    {
+        std::lock_guard<std::mutex> lock(_wakeMutex);
+        _stop = true;
+    }
+    _wakeCondition.notify_one();
+    _thread.join();
+}
+
+void NetworkIoThread::AddConnection(NetworkConnection& connection)
+{
+    connection.SetServicedByIoThread(true);
+
+    std::lock_guard<std::mutex> lock(_connectionsMutex);
+    _connections.push_back(&connection);
+}
+
+void NetworkIoThread::RemoveConnection(NetworkConnection& connection)
+{
+    {
+        std::lock_guard<std::mutex> lock(_connectionsMutex);
+        _connections.erase(std::remove(_connections.begin(), _connections.end(), &connection), _connections.end());
+    }
+    connection.SetServicedByIoThread(false);
+}
+
+void NetworkIoThread::Wake()
+{
+    {
+        std::lock_guard<std::mutex> lock(_wakeMutex);
+        _woken = true;
+    }
+    _wakeCondition.notify_one();
+}
+
+void NetworkIoThread::Run()
+{
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(_wakeMutex);
+            _wakeCondition.wait_for(lock, NetworkIoPollInterval, [this] { return _woken || _stop; });
+            if (_stop)
+                break;
+
+            _woken = false;
+        }
+
+        // Held for the whole pass so that a removed connection is never in use.
+        std::lock_guard<std::mutex> lock(_connectionsMutex);
+        for (auto* connection : _connections)
+        {
+            connection->UpdateIo();
+        }
+    }
+}
+
+#endif // DISABLE_NETWORK
@@ -0,0 +1,59 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2022 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#ifndef DISABLE_NETWORK
+
+#    include <condition_variable>
+#    include <mutex>
+#    include <thread>
+#    include <vector>
+
+class NetworkConnection;
+
+/**
+ * Thread that reads and writes the sockets of network connections, so that slow clients and bursts of traffic do not
+ * hold up the game thread. Complete packets are handed to the game thread, which still processes them and owns all
+ * game state.
+ */
+class NetworkIoThread final
+{
+public:
+    NetworkIoThread();
+    ~NetworkIoThread();
+
+    NetworkIoThread(const NetworkIoThread&) = delete;
+    NetworkIoThread& operator=(const NetworkIoThread&) = delete;
+
+    void AddConnection(NetworkConnection& connection);
+
+    /**
+     * Stops servicing the connection, once this returns the thread no longer uses it.
+     */
+    void RemoveConnection(NetworkConnection& connection);
+
+    /**
+     * Wakes the thread up to send packets that have just been handed over.
+     */
+    void Wake();
+
+private:
+    std::thread _thread;
+    std::mutex _connectionsMutex;
+    std::vector<NetworkConnection*> _connections;
+    std::mutex _wakeMutex;
+    std::condition_variable _wakeCondition;
+    bool _woken = false;
+    bool _stop = false;
+
+    void Run();
+};
+
+#endif // DISABLE_NETWORK
@@ -79,3 +79,6 @@ public:
     size_t BytesTransferred = 0;
     size_t BytesRead = 0;
 };
+
+// Packet that is queued on several connections without copying its payload, it must not be modified once shared.
+using NetworkSharedPacket = std::shared_ptr<const NetworkPacket>;
@@ -144,4 +144,6 @@ struct NetworkStats_t
 {
     uint64_t bytesReceived[EnumValue(NetworkStatisticsGroup::Max)];
     uint64_t bytesSent[EnumValue(NetworkStatisticsGroup::Max)];
+    uint64_t bytesCopied; // Bytes copied into send buffers.
+    uint64_t sendCalls;   // Calls made to send data on the socket.
 };
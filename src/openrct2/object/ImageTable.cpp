@@ -15,6 +15,7 @@
 #include "../core/File.h"
 #include "../core/FileScanner.h"
 #include "../core/IStream.hpp"
+#include "../core/JobPool.h"
 #include "../core/Json.hpp"
 #include "../core/Path.hpp"
 #include "../core/String.hpp"
@@ -22,9 +23,13 @@
 #include "../sprites.h"
 #include "Object.h"
 #include "ObjectFactory.h"
+#include "ObjectManager.h"
 
 #include <algorithm>
+#include <exception>
+#include <functional>
 #include <memory>
+#include <optional>
 #include <stdexcept>
 
 using namespace OpenRCT2;
@@ -35,6 +40,10 @@ struct ImageTable::RequiredImage
     rct_g1_element g1{};
     std::unique_ptr<RequiredImage> next_zoom;
 
+    // Decoding and importing a PNG is deferred so that ReadJson can run all of an object's imports at once.
+    std::string pending_path;
+    std::function<std::unique_ptr<RequiredImage>()> pending_import;
+
     bool HasData() const
     {
         return g1.offset != nullptr;
@@ -141,13 +150,18 @@ std::vector<std::unique_ptr<ImageTable::RequiredImage>> ImageTable::ParseImages(
     {
         try
         {
-            auto imageData = context->GetData(s);
-            auto image = Imaging::ReadFromBuffer(imageData);
-
-            ImageImporter importer;
-            auto importResult = importer.Import(image, 0, 0, ImageImporter::Palette::OpenRCT2, ImageImporter::ImportFlags::RLE);
-
-            result.push_back(std::make_unique<RequiredImage>(importResult.Element));
+            auto pending = std::make_unique<RequiredImage>();
+            pending->pending_path = s;
+            pending->pending_import = [imageData = context->GetData(s)]() {
+                auto image = Imaging::ReadFromBuffer(imageData);
+
+                ImageImporter importer;
+                auto importResult = importer.Import(
+                    image, 0, 0, ImageImporter::Palette::OpenRCT2, ImageImporter::ImportFlags::RLE);
+
+                return std::make_unique<RequiredImage>(importResult.Element);
+            };
+            result.push_back(std::move(pending));
         }
         catch (const std::exception& e)
         {
@@ -196,19 +210,24 @@ std::vector<std::unique_ptr<ImageTable::RequiredImage>> ImageTable::ParseImages(
         {
             throw std::runtime_error("Unable to find image in image source list.");
         }
-        auto& image = itSource->second;
+        const auto* image = &itSource->second;
 
         if (srcWidth == 0)
-            srcWidth = image.Width;
+            srcWidth = image->Width;
 
         if (srcHeight == 0)
-            srcHeight = image.Height;
+            srcHeight = image->Height;
 
-        ImageImporter importer;
-        auto importResult = importer.Import(image, srcX, srcY, srcWidth, srcHeight, x, y, palette, flags);
-        auto g1element = importResult.Element;
-        g1element.zoomed_offset = zoomOffset;
-        result.push_back(std::make_unique<RequiredImage>(g1element));
+        auto pending = std::make_unique<RequiredImage>();
+        pending->pending_path = path;
+        pending->pending_import = [=]() {
+            ImageImporter importer;
+            auto importResult = importer.Import(*image, srcX, srcY, srcWidth, srcHeight, x, y, palette, flags);
+            auto g1element = importResult.Element;
+            g1element.zoomed_offset = zoomOffset;
+            return std::make_unique<RequiredImage>(g1element);
+        };
+        result.push_back(std::move(pending));
     }
     catch (const std::exception& e)
     {
@@ -422,7 +441,10 @@ void ImageTable::Read(IReadObjectContext* context, OpenRCT2::IStream* stream)
 
 std::vector<std::pair<std::string, Image>> ImageTable::GetImageSources(IReadObjectContext* context, json_t& jsonImages)
 {
+    // Reading from the object's archive is not thread safe, only the decoding is spread over the job pool.
     std::vector<std::pair<std::string, Image>> result;
+    std::vector<std::vector<uint8_t>> imageData;
+    std::vector<IMAGE_FORMAT> imageFormats;
     for (auto& jsonImage : jsonImages)
     {
         if (jsonImage.is_object())
@@ -434,17 +456,71 @@ std::vector<std::pair<std::string, Image>> ImageTable::GetImageSources(IReadObje
             });
             if (itSource == result.end())
             {
-                auto imageData = context->GetData(path);
-                auto imageFormat = keepPalette ? IMAGE_FORMAT::PNG : IMAGE_FORMAT::PNG_32;
-                auto image = Imaging::ReadFromBuffer(imageData, imageFormat);
-                auto pair = std::make_pair<std::string, Image>(std::move(path), std::move(image));
-                result.push_back(std::move(pair));
+                imageData.push_back(context->GetData(path));
+                imageFormats.push_back(keepPalette ? IMAGE_FORMAT::PNG : IMAGE_FORMAT::PNG_32);
+                result.emplace_back(std::move(path), Image());
             }
         }
     }
+
+    std::vector<std::exception_ptr> errors(result.size());
+    GetObjectLoadJobPool().ParallelFor(result.size(), [&](size_t i) {
+        try
+        {
+            result[i].second = Imaging::ReadFromBuffer(imageData[i], imageFormats[i]);
+        }
+        catch (...)
+        {
+            errors[i] = std::current_exception();
+        }
+    });
+    for (const auto& error : errors)
+    {
+        if (error != nullptr)
+        {
+            std::rethrow_exception(error);
+        }
+    }
     return result;
 }
 
+void ImageTable::ImportPendingImages(IReadObjectContext* context, std::vector<std::unique_ptr<RequiredImage>>& images)
+{
+    std::vector<size_t> pendingIndices;
+    for (size_t i = 0; i < images.size(); i++)
+    {
+        if (images[i]->pending_import)
+        {
+            pendingIndices.push_back(i);
+        }
+    }
+
+    std::vector<std::optional<std::string>> errors(pendingIndices.size());
+    GetObjectLoadJobPool().ParallelFor(pendingIndices.size(), [&](size_t i) {
+        auto& image = images[pendingIndices[i]];
+        try
+        {
+            image = image->pending_import();
+        }
+        catch (const std::exception& e)
+        {
+            errors[i] = e.what();
+        }
+    });
+
+    // Warnings are logged afterwards so they keep the order of the images.
+    for (size_t i = 0; i < pendingIndices.size(); i++)
+    {
+        if (errors[i].has_value())
+        {
+            auto& image = images[pendingIndices[i]];
+            auto msg = String::StdFormat("Unable to load image '%s': %s", image->pending_path.c_str(), errors[i]->c_str());
+            context->LogWarning(ObjectError::BadImageTable, msg.c_str());
+            image = std::make_unique<RequiredImage>();
+        }
+    }
+}
+
 bool ImageTable::ReadJson(IReadObjectContext* context, json_t& root)
 {
     Guard::Assert(root.is_object(), "ImageTable::ReadJson expects parameter root to be object");
@@ -480,6 +556,7 @@ bool ImageTable::ReadJson(IReadObjectContext* context, json_t& root)
                     allImages.end(), std::make_move_iterator(images.begin()), std::make_move_iterator(images.end()));
             }
         }
+        ImportPendingImages(context, allImages);
 
         // Now add all the images to the image table
         auto imagesStartIndex = GetCount();
@@ -43,6 +43,10 @@ private:
         IReadObjectContext* context, std::vector<std::pair<std::string, Image>>& imageSources, json_t& el);
     [[nodiscard]] static std::vector<std::unique_ptr<ImageTable::RequiredImage>> LoadObjectImages(
         IReadObjectContext* context, const std::string& name, const std::vector<int32_t>& range);
+    /**
+     * Runs the imports ParseImages deferred on the object load job pool, failed imports become placeholders.
+     */
+    static void ImportPendingImages(IReadObjectContext* context, std::vector<std::unique_ptr<RequiredImage>>& images);
     [[nodiscard]] static std::vector<int32_t> ParseRange(std::string s);
     [[nodiscard]] static std::string FindLegacyObject(const std::string& name);
 
@@ -12,8 +12,10 @@
 #include "../Context.h"
 #include "../ParkImporter.h"
 #include "../core/Console.hpp"
+#include "../core/JobPool.h"
 #include "../core/Memory.hpp"
 #include "../localisation/StringIds.h"
+#include "../paint/PaintCache.h"
 #include "../ride/Ride.h"
 #include "../util/Util.h"
 #include "FootpathItemObject.h"
@@ -30,7 +32,6 @@
 #include <array>
 #include <memory>
 #include <mutex>
-#include <thread>
 #include <unordered_set>
 
 class ObjectManager final : public IObjectManager
@@ -178,6 +179,7 @@ public:
         // Update indices.
         UpdateSceneryGroupIndexes();
         ResetTypeToRideEntryIndexMap();
+        PaintCacheInvalidate();
     }
 
     void UnloadObjects(const std::vector<ObjectEntryDescriptor>& entries) override
@@ -205,6 +207,7 @@ public:
         {
             UpdateSceneryGroupIndexes();
             ResetTypeToRideEntryIndexMap();
+            PaintCacheInvalidate();
         }
     }
 
@@ -216,6 +219,7 @@ public:
         }
         UpdateSceneryGroupIndexes();
         ResetTypeToRideEntryIndexMap();
+        PaintCacheInvalidate();
     }
 
     void ResetObjects() override
@@ -230,6 +234,7 @@ public:
         }
         UpdateSceneryGroupIndexes();
         ResetTypeToRideEntryIndexMap();
+        PaintCacheInvalidate();
     }
 
     std::vector<const ObjectRepositoryItem*> GetPackableObjects() override
@@ -322,6 +327,7 @@ private:
                 _loadedObjects[slot.value()] = object;
                 UpdateSceneryGroupIndexes();
                 ResetTypeToRideEntryIndexMap();
+                PaintCacheInvalidate();
             }
         }
         return loadedObject;
@@ -504,30 +510,6 @@ private:
         return requiredObjects;
     }
 
-    template<typename T, typename TFunc> static void ParallelFor(const std::vector<T>& items, TFunc func)
-    {
-        auto partitions = std::thread::hardware_concurrency();
-        auto partitionSize = (items.size() + (partitions - 1)) / partitions;
-        std::vector<std::thread> threads;
-        for (size_t n = 0; n < partitions; n++)
-        {
-            auto begin = n * partitionSize;
-            auto end = std::min(items.size(), begin + partitionSize);
-            threads.emplace_back(
-                [func](size_t pbegin, size_t pend) {
-                    for (size_t i = pbegin; i < pend; i++)
-                    {
-                        func(i);
-                    }
-                },
-                begin, end);
-        }
-        for (auto& t : threads)
-        {
-            t.join();
-        }
-    }
-
     void LoadObjects(std::vector<const ObjectRepositoryItem*>& requiredObjects)
     {
         std::vector<Object*> objects;
@@ -538,7 +520,7 @@ private:
 
         // Read objects
         std::mutex commonMutex;
-        ParallelFor(requiredObjects, [this, &commonMutex, requiredObjects, &objects, &badObjects, &newLoadedObjects](size_t i) {
+        GetObjectLoadJobPool().ParallelFor(requiredObjects.size(), [&](size_t i) {
             auto* requiredObject = requiredObjects[i];
             Object* object = nullptr;
             if (requiredObject != nullptr)
@@ -684,6 +666,12 @@ std::unique_ptr<IObjectManager> CreateObjectManager(IObjectRepository& objectRep
     return std::make_unique<ObjectManager>(objectRepository);
 }
 
+JobPool& GetObjectLoadJobPool()
+{
+    static JobPool jobPool;
+    return jobPool;
+}
+
 Object* object_manager_get_loaded_object(const ObjectEntryDescriptor& entry)
 {
     auto& objectManager = OpenRCT2::GetContext()->GetObjectManager();
@@ -15,6 +15,7 @@
 #include <vector>
 
 struct IObjectRepository;
+class JobPool;
 class Object;
 class ObjectList;
 struct ObjectRepositoryItem;
@@ -48,6 +49,11 @@ struct IObjectManager
 
 [[nodiscard]] std::unique_ptr<IObjectManager> CreateObjectManager(IObjectRepository& objectRepository);
 
+/**
+ * Threads shared by the object manager and the image tables of the objects it loads.
+ */
+[[nodiscard]] JobPool& GetObjectLoadJobPool();
+
 [[nodiscard]] Object* object_manager_get_loaded_object(const ObjectEntryDescriptor& entry);
 [[nodiscard]] ObjectEntryIndex object_manager_get_loaded_object_entry_index(const Object* loadedObject);
 [[nodiscard]] ObjectEntryIndex object_manager_get_loaded_object_entry_index(const ObjectEntryDescriptor& entry);
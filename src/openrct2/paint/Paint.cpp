@@ -19,12 +19,14 @@
 #include "../paint/Painter.h"
 #include "../profiling/Profiling.h"
 #include "../util/Math.hpp"
+#include "../util/Util.h"
 #include "Paint.Entity.h"
 #include "tile_element/Paint.TileElement.h"
 
 #include <algorithm>
 #include <array>
 #include <atomic>
+#include <vector>
 
 using namespace OpenRCT2;
 
@@ -84,7 +86,22 @@ static int32_t RemapPositionToQuadrant(const paint_struct& ps, uint8_t rotation)
     return 0;
 }
 
-static void PaintSessionAddPSToQuadrant(paint_session& session, paint_struct* ps)
+/**
+ * A tile that reads or extends a paint struct created before it was painted cannot be replayed from the paint cache.
+ */
+static void PaintCacheCheckParent(paint_session& session, bool attached)
+{
+    const auto* recording = session.CacheRecording;
+    if (recording == nullptr || recording->ParentsReset)
+        return;
+
+    if (attached ? recording->AttachedStructs.empty() : recording->Structs.empty())
+    {
+        session.Flags |= PaintSessionFlags::Uncacheable;
+    }
+}
+
+void PaintSessionAddPSToQuadrant(paint_session& session, paint_struct* ps)
 {
     const auto positionHash = RemapPositionToQuadrant(*ps, session.CurrentRotation);
 
@@ -97,6 +114,11 @@ static void PaintSessionAddPSToQuadrant(paint_session& session, paint_struct* ps
 
     session.QuadrantBackIndex = std::min(session.QuadrantBackIndex, paintQuadrantIndex);
     session.QuadrantFrontIndex = std::max(session.QuadrantFrontIndex, paintQuadrantIndex);
+
+    if (session.CacheRecording != nullptr)
+    {
+        session.CacheRecording->QuadrantStructs.push_back(ps);
+    }
 }
 
 static constexpr bool ImageWithinDPI(const ScreenCoordsXY& imagePos, const rct_g1_element& g1, const rct_drawpixelinfo& dpi)
@@ -176,6 +198,10 @@ static paint_struct* CreateNormalPaintStruct(
     {
         return nullptr;
     }
+    if (session.CacheRecording != nullptr)
+    {
+        session.CacheRecording->Structs.push_back(ps);
+    }
 
     ps->image_id = image_id;
     ps->x = imagePos.x;
@@ -309,19 +335,19 @@ template<> bool CheckBoundingBox<3>(const paint_struct_bound_box& initialBBox, c
     return false;
 }
 
-namespace PaintSortFlags
-{
-    static constexpr uint8_t None = 0;
-    static constexpr uint8_t PendingVisit = (1U << 0);
-    static constexpr uint8_t Neighbour = (1U << 1);
-    static constexpr uint8_t OutsideQuadrant = (1U << 7);
-} // namespace PaintSortFlags
+// Compares the paint structs with SIMD when arranging, null to walk the quadrant lists instead.
+static PaintSortNeighboursFn _paintSortNeighboursFn = nullptr;
 
-template<uint8_t TRotation>
-static paint_struct* PaintArrangeStructsHelperRotation(paint_struct* ps_next, uint16_t quadrantIndex, uint8_t flag)
+// Quadrants with fewer paint structs than this are cheaper to sort by walking the list.
+static constexpr size_t PaintSortMinSoANodes = 16;
+
+/**
+ * Marks the paint structs of the specified quadrant and its neighbour for sorting. Returns the node before the first
+ * node in the quadrant.
+ */
+static paint_struct* PaintSortMarkQuadrant(paint_struct* ps_next, uint16_t quadrantIndex, uint8_t flag)
 {
     paint_struct* ps;
-    paint_struct* ps_temp;
 
     // Get the first node in the specified quadrant.
     do
@@ -338,7 +364,6 @@ static paint_struct* PaintArrangeStructsHelperRotation(paint_struct* ps_next, ui
 
     // Visit all nodes in the linked quadrant list and determine their current
     // sorting relevancy.
-    ps_temp = ps;
     do
     {
         ps = ps->next_quadrant_ps;
@@ -361,10 +386,19 @@ static paint_struct* PaintArrangeStructsHelperRotation(paint_struct* ps_next, ui
             ps->SortFlags = flag | PaintSortFlags::PendingVisit;
         }
     } while (ps->quadrant_index <= quadrantIndex + 1);
-    ps = ps_temp;
 
-    // Iterate all nodes in the current list and re-order them based on
-    // the current rotation and their bounding box.
+    return psQuadrantEntry;
+}
+
+/**
+ * Iterates all nodes after psQuadrantEntry and re-orders them based on the current rotation and their bounding box.
+ */
+template<uint8_t TRotation> static void PaintSortQuadrantList(paint_struct* psQuadrantEntry)
+{
+    paint_struct* ps = psQuadrantEntry;
+    paint_struct* ps_next;
+    paint_struct* ps_temp;
+
     while (true)
     {
         // Get the first pending node in the quadrant list
@@ -374,12 +408,12 @@ static paint_struct* PaintArrangeStructsHelperRotation(paint_struct* ps_next, ui
             if (ps_next == nullptr)
             {
                 // End of the current list.
-                return psQuadrantEntry;
+                return;
             }
             if (ps_next->SortFlags & PaintSortFlags::OutsideQuadrant)
             {
                 // Reached point outside of specified quadrant.
-                return psQuadrantEntry;
+                return;
             }
             if (ps_next->SortFlags & PaintSortFlags::PendingVisit)
             {
@@ -425,7 +459,159 @@ static paint_struct* PaintArrangeStructsHelperRotation(paint_struct* ps_next, ui
     }
 }
 
-template<int TRotation> static void PaintSessionArrange(PaintSessionCore& session, bool)
+template<uint8_t TRotation>
+static paint_struct* PaintArrangeStructsHelperRotation(paint_struct* ps_next, uint16_t quadrantIndex, uint8_t flag)
+{
+    paint_struct* psQuadrantEntry = PaintSortMarkQuadrant(ps_next, quadrantIndex, flag);
+    PaintSortQuadrantList<TRotation>(psQuadrantEntry);
+    return psQuadrantEntry;
+}
+
+/**
+ * Moves the values at the given positions, which all come after position, in front of the value at position. Each one
+ * is moved to the front in turn, so they end up in reverse order. This is the order the list walk leaves them in.
+ */
+template<typename T>
+static void PaintSortMoveToFront(
+    std::vector<T>& values, std::vector<T>& movedValues, size_t position, const std::vector<uint32_t>& moved)
+{
+    movedValues.clear();
+    for (auto it = moved.rbegin(); it != moved.rend(); ++it)
+    {
+        movedValues.push_back(values[*it]);
+    }
+
+    // Shift the values in between towards the back, over the gaps left by the moved values.
+    const size_t movedCount = moved.size();
+    for (size_t i = movedCount; i-- > 0;)
+    {
+        const size_t segmentBegin = i == 0 ? position : moved[i - 1] + 1;
+        std::copy_backward(
+            values.begin() + segmentBegin, values.begin() + moved[i], values.begin() + moved[i] + (movedCount - i));
+    }
+    std::copy(movedValues.begin(), movedValues.end(), values.begin() + position);
+}
+
+static void PaintSortMoveToFront(
+    PaintSortBounds& bounds, PaintSortBounds& movedBounds, size_t position, const std::vector<uint32_t>& moved)
+{
+    PaintSortMoveToFront(bounds.X, movedBounds.X, position, moved);
+    PaintSortMoveToFront(bounds.Y, movedBounds.Y, position, moved);
+    PaintSortMoveToFront(bounds.Z, movedBounds.Z, position, moved);
+    PaintSortMoveToFront(bounds.XEnd, movedBounds.XEnd, position, moved);
+    PaintSortMoveToFront(bounds.YEnd, movedBounds.YEnd, position, moved);
+    PaintSortMoveToFront(bounds.ZEnd, movedBounds.ZEnd, position, moved);
+    PaintSortMoveToFront(bounds.SortFlags, movedBounds.SortFlags, position, moved);
+    PaintSortMoveToFront(bounds.Nodes, movedBounds.Nodes, position, moved);
+}
+
+/**
+ * Same as PaintArrangeStructsHelperRotation, but the nodes of the quadrant are copied into contiguous arrays so each
+ * node can be compared against all the remaining ones at once with SIMD. The resulting order is identical.
+ */
+template<uint8_t TRotation>
+static paint_struct* PaintArrangeStructsHelperSoA(
+    paint_struct* ps_next, uint16_t quadrantIndex, uint8_t flag, PaintSortNeighboursFn sortNeighboursFn)
+{
+    thread_local PaintSortBounds bounds;
+    thread_local std::vector<uint32_t> result;
+    thread_local std::vector<uint32_t> moved;
+    thread_local PaintSortBounds movedBounds;
+
+    paint_struct* psQuadrantEntry = PaintSortMarkQuadrant(ps_next, quadrantIndex, flag);
+
+    // The list walk stops at the first node outside of the quadrant, every node before it takes part in the sort.
+    size_t count = 0;
+    paint_struct* psEnd = psQuadrantEntry->next_quadrant_ps;
+    for (; psEnd != nullptr && !(psEnd->SortFlags & PaintSortFlags::OutsideQuadrant); psEnd = psEnd->next_quadrant_ps)
+    {
+        count++;
+    }
+    if (count < PaintSortMinSoANodes)
+    {
+        PaintSortQuadrantList<TRotation>(psQuadrantEntry);
+        return psQuadrantEntry;
+    }
+
+    // The padding only needs its sort flags cleared, that alone stops it from being compared.
+    const size_t paddedCount = count + PaintSortBounds::PaddingCount;
+    bounds.X.resize(paddedCount);
+    bounds.Y.resize(paddedCount);
+    bounds.Z.resize(paddedCount);
+    bounds.XEnd.resize(paddedCount);
+    bounds.YEnd.resize(paddedCount);
+    bounds.ZEnd.resize(paddedCount);
+    bounds.SortFlags.resize(paddedCount);
+    bounds.Nodes.resize(paddedCount);
+    std::fill(bounds.SortFlags.begin() + count, bounds.SortFlags.end(), 0);
+
+    paint_struct* ps = psQuadrantEntry->next_quadrant_ps;
+    for (size_t i = 0; i < count; i++, ps = ps->next_quadrant_ps)
+    {
+        bounds.X[i] = ps->bounds.x;
+        bounds.Y[i] = ps->bounds.y;
+        bounds.Z[i] = ps->bounds.z;
+        bounds.XEnd[i] = ps->bounds.x_end;
+        bounds.YEnd[i] = ps->bounds.y_end;
+        bounds.ZEnd[i] = ps->bounds.z_end;
+        bounds.SortFlags[i] = ps->SortFlags;
+        bounds.Nodes[i] = ps;
+    }
+
+    size_t position = 0;
+    while (true)
+    {
+        // Get the first pending node.
+        while (position < count && !(bounds.SortFlags[position] & PaintSortFlags::PendingVisit))
+        {
+            position++;
+        }
+        if (position == count)
+            break;
+
+        // Mark visited.
+        bounds.SortFlags[position] &= ~PaintSortFlags::PendingVisit;
+
+        // Compare current node against the remaining children.
+        const paint_struct_bound_box initialBBox = {
+            bounds.X[position],    bounds.Y[position],    bounds.Z[position],
+            bounds.XEnd[position], bounds.YEnd[position], bounds.ZEnd[position],
+        };
+        const size_t begin = position + 1;
+        result.resize((count - begin + 31) / 32 + 1);
+        sortNeighboursFn(bounds, begin, count, initialBBox, TRotation, result.data());
+
+        moved.clear();
+        for (size_t word = 0; word * 32 < count - begin; word++)
+        {
+            for (uint32_t bits = result[word]; bits != 0; bits &= bits - 1)
+            {
+                moved.push_back(static_cast<uint32_t>(begin + word * 32 + bitscanforward(static_cast<int32_t>(bits))));
+            }
+        }
+
+        // Child nodes that intersect with the current node are moved behind it.
+        if (!moved.empty())
+        {
+            PaintSortMoveToFront(bounds, movedBounds, position, moved);
+        }
+    }
+
+    // Relink the list in the sorted order.
+    ps = psQuadrantEntry;
+    for (size_t i = 0; i < count; i++)
+    {
+        ps->next_quadrant_ps = bounds.Nodes[i];
+        ps = bounds.Nodes[i];
+        ps->SortFlags = bounds.SortFlags[i];
+    }
+    ps->next_quadrant_ps = psEnd;
+
+    return psQuadrantEntry;
+}
+
+template<int TRotation>
+static void PaintSessionArrange(PaintSessionCore& session, PaintSortNeighboursFn sortNeighboursFn)
 {
     paint_struct* psHead = &session.PaintHead;
 
@@ -450,13 +636,18 @@ template<int TRotation> static void PaintSessionArrange(PaintSessionCore& sessio
             }
         } while (++quadrantIndex <= session.QuadrantFrontIndex);
 
-        paint_struct* ps_cache = PaintArrangeStructsHelperRotation<TRotation>(
-            psHead, session.QuadrantBackIndex & 0xFFFF, PaintSortFlags::Neighbour);
+        auto arrangeQuadrant = [sortNeighboursFn](paint_struct* psStart, uint32_t index, uint8_t flag) {
+            if (sortNeighboursFn != nullptr)
+                return PaintArrangeStructsHelperSoA<TRotation>(psStart, index & 0xFFFF, flag, sortNeighboursFn);
+            return PaintArrangeStructsHelperRotation<TRotation>(psStart, index & 0xFFFF, flag);
+        };
+
+        paint_struct* ps_cache = arrangeQuadrant(psHead, session.QuadrantBackIndex, PaintSortFlags::Neighbour);
 
         quadrantIndex = session.QuadrantBackIndex;
         while (++quadrantIndex < session.QuadrantFrontIndex)
         {
-            ps_cache = PaintArrangeStructsHelperRotation<TRotation>(ps_cache, quadrantIndex & 0xFFFF, PaintSortFlags::None);
+            ps_cache = arrangeQuadrant(ps_cache, quadrantIndex, PaintSortFlags::None);
         }
     }
 }
@@ -466,22 +657,49 @@ template<int TRotation> static void PaintSessionArrange(PaintSessionCore& sessio
  *  rct2: 0x00688217
  */
 void PaintSessionArrange(PaintSessionCore& session)
+{
+    PaintSessionArrange(session, _paintSortNeighboursFn);
+}
+
+/**
+ * Arranges the paint structs using the given SIMD comparisons, or by walking the quadrant lists if null.
+ */
+void PaintSessionArrange(PaintSessionCore& session, PaintSortNeighboursFn sortNeighboursFn)
 {
     PROFILED_FUNCTION();
     switch (session.CurrentRotation)
     {
         case 0:
-            return PaintSessionArrange<0>(session, true);
+            return PaintSessionArrange<0>(session, sortNeighboursFn);
         case 1:
-            return PaintSessionArrange<1>(session, true);
+            return PaintSessionArrange<1>(session, sortNeighboursFn);
         case 2:
-            return PaintSessionArrange<2>(session, true);
+            return PaintSessionArrange<2>(session, sortNeighboursFn);
         case 3:
-            return PaintSessionArrange<3>(session, true);
+            return PaintSessionArrange<3>(session, sortNeighboursFn);
     }
     Guard::Assert(false);
 }
 
+void PaintSortInit()
+{
+    if (avx2_available())
+    {
+        log_verbose("registering AVX2 paint sort function");
+        _paintSortNeighboursFn = paint_sort_neighbours_avx2;
+    }
+    else if (sse41_available())
+    {
+        log_verbose("registering SSE4.1 paint sort function");
+        _paintSortNeighboursFn = paint_sort_neighbours_sse4_1;
+    }
+    else
+    {
+        log_verbose("registering list walk paint sort function");
+        _paintSortNeighboursFn = nullptr;
+    }
+}
+
 static void PaintDrawStruct(paint_session& session, paint_struct* ps)
 {
     rct_drawpixelinfo* dpi = &session.DPI;
@@ -768,6 +986,10 @@ paint_struct* PaintAddImageAsParent(
 {
     session.LastPS = nullptr;
     session.LastAttachedPS = nullptr;
+    if (session.CacheRecording != nullptr)
+    {
+        session.CacheRecording->ParentsReset = true;
+    }
 
     auto* ps = CreateNormalPaintStruct(session, image_id, offset, boundBoxSize, boundBoxOffset);
     if (ps == nullptr)
@@ -803,6 +1025,10 @@ paint_struct* PaintAddImageAsParent(
 {
     session.LastPS = nullptr;
     session.LastAttachedPS = nullptr;
+    if (session.CacheRecording != nullptr)
+    {
+        session.CacheRecording->ParentsReset = true;
+    }
     return CreateNormalPaintStruct(session, imageId, offset, boundBoxSize, boundBoxOffset);
 }
 
@@ -834,6 +1060,8 @@ paint_struct* PaintAddImageAsChild(
     paint_session& session, ImageId image_id, const CoordsXYZ& offset, const CoordsXYZ& boundBoxLength,
     const CoordsXYZ& boundBoxOffset)
 {
+    PaintCacheCheckParent(session, false);
+
     paint_struct* parentPS = session.LastPS;
     if (parentPS == nullptr)
     {
@@ -861,6 +1089,8 @@ paint_struct* PaintAddImageAsChild(
  */
 bool PaintAttachToPreviousAttach(paint_session& session, ImageId imageId, int32_t x, int32_t y)
 {
+    PaintCacheCheckParent(session, true);
+
     auto* previousAttachedPS = session.LastAttachedPS;
     if (previousAttachedPS == nullptr)
     {
@@ -872,6 +1102,10 @@ bool PaintAttachToPreviousAttach(paint_session& session, ImageId imageId, int32_
     {
         return false;
     }
+    if (session.CacheRecording != nullptr)
+    {
+        session.CacheRecording->AttachedStructs.push_back(ps);
+    }
 
     ps->image_id = imageId;
     ps->x = x;
@@ -899,6 +1133,8 @@ bool PaintAttachToPreviousPS(paint_session& session, uint32_t image_id, int32_t
 
 bool PaintAttachToPreviousPS(paint_session& session, ImageId image_id, int32_t x, int32_t y)
 {
+    PaintCacheCheckParent(session, false);
+
     auto* masterPs = session.LastPS;
     if (masterPs == nullptr)
     {
@@ -910,6 +1146,10 @@ bool PaintAttachToPreviousPS(paint_session& session, ImageId image_id, int32_t x
     {
         return false;
     }
+    if (session.CacheRecording != nullptr)
+    {
+        session.CacheRecording->AttachedStructs.push_back(ps);
+    }
 
     ps->image_id = image_id;
     ps->x = x;
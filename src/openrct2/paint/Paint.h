@@ -18,6 +18,7 @@
 
 #include <mutex>
 #include <thread>
+#include <vector>
 
 struct TileElement;
 enum class RailingEntrySupportType : uint8_t;
@@ -215,10 +216,26 @@ struct PaintSessionCore
     ViewportInteractionItem InteractionType;
 };
 
+class PaintTileCache;
+
+/**
+ * Paint structs created while a tile is recorded for the paint cache, see PaintCache.h.
+ */
+struct PaintCacheRecording
+{
+    std::vector<paint_struct*> Structs;
+    std::vector<attached_paint_struct*> AttachedStructs;
+    std::vector<paint_struct*> QuadrantStructs;
+    // Set once LastPS and LastAttachedPS have been reset, until then they may refer to paint structs of another tile.
+    bool ParentsReset{};
+};
+
 struct paint_session : public PaintSessionCore
 {
     rct_drawpixelinfo DPI;
     PaintEntryPool::Chain PaintEntryChain;
+    PaintTileCache* TileCache{};
+    PaintCacheRecording* CacheRecording{};
 
     paint_struct* AllocateNormalPaintEntry() noexcept
     {
@@ -281,6 +298,48 @@ struct RecordedPaintSession
     std::vector<paint_entry> Entries;
 };
 
+namespace PaintSortFlags
+{
+    static constexpr uint8_t None = 0;
+    static constexpr uint8_t PendingVisit = (1U << 0);
+    static constexpr uint8_t Neighbour = (1U << 1);
+    static constexpr uint8_t OutsideQuadrant = (1U << 7);
+} // namespace PaintSortFlags
+
+/**
+ * Structure of arrays copy of the bounding boxes and sort flags of the paint structs being arranged, in their current
+ * order in the quadrant list. The arrays are padded with PaddingCount zeroed entries so the SIMD comparisons can read
+ * past the last paint struct.
+ */
+struct PaintSortBounds
+{
+    static constexpr size_t PaddingCount = 32;
+
+    std::vector<int32_t> X;
+    std::vector<int32_t> Y;
+    std::vector<int32_t> Z;
+    std::vector<int32_t> XEnd;
+    std::vector<int32_t> YEnd;
+    std::vector<int32_t> ZEnd;
+    std::vector<uint8_t> SortFlags;
+    std::vector<paint_struct*> Nodes;
+};
+
+/**
+ * Sets a bit in result for every paint struct in [begin, end) that is a neighbour and has to be drawn before the one
+ * with the initial bounding box, bit 0 being begin. Fills (end - begin + 31) / 32 words.
+ */
+using PaintSortNeighboursFn = void (*)(
+    const PaintSortBounds& bounds, size_t begin, size_t end, const paint_struct_bound_box& initial, uint8_t rotation,
+    uint32_t* result);
+
+void paint_sort_neighbours_sse4_1(
+    const PaintSortBounds& bounds, size_t begin, size_t end, const paint_struct_bound_box& initial, uint8_t rotation,
+    uint32_t* result);
+void paint_sort_neighbours_avx2(
+    const PaintSortBounds& bounds, size_t begin, size_t end, const paint_struct_bound_box& initial, uint8_t rotation,
+    uint32_t* result);
+
 extern paint_session gPaintSession;
 
 // Globals for paint clipping
@@ -334,10 +393,13 @@ void PaintFloatingMoneyEffect(
     paint_session& session, money64 amount, rct_string_id string_id, int32_t y, int32_t z, int8_t y_offsets[], int32_t offset_x,
     uint32_t rotation);
 
+void PaintSessionAddPSToQuadrant(paint_session& session, paint_struct* ps);
 paint_session* PaintSessionAlloc(rct_drawpixelinfo* dpi, uint32_t viewFlags);
 void PaintSessionFree(paint_session* session);
 void PaintSessionGenerate(paint_session& session);
 void PaintSessionArrange(PaintSessionCore& session);
+void PaintSessionArrange(PaintSessionCore& session, PaintSortNeighboursFn sortNeighboursFn);
+void PaintSortInit();
 void PaintDrawStructs(paint_session& session);
 void PaintDrawMoneyStructs(rct_drawpixelinfo* dpi, paint_string_struct* ps);
 
@@ -0,0 +1,432 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2022 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "PaintCache.h"
+
+#include "../Cheats.h"
+#include "../OpenRCT2.h"
+#include "../config/Config.h"
+#include "../drawing/LightFX.h"
+#include "../entity/PatrolArea.h"
+#include "../interface/Viewport.h"
+#include "../ride/TrackDesign.h"
+#include "../world/Map.h"
+#include "Paint.h"
+#include "VirtualFloor.h"
+#include "tile_element/Paint.TileElement.h"
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+namespace
+{
+    // Columns of viewports that have not been painted for a while are dropped beyond this count.
+    constexpr size_t MaxColumns = 256;
+
+    // The surfaces of the four neighbouring tiles are part of the snapshot, surfaces are blended with them.
+    constexpr size_t NumNeighbours = 4;
+
+    struct CachedTile
+    {
+        const TileElement* FirstElement{};
+        std::vector<uint8_t> Snapshot;
+        bool Cacheable{};
+
+        // Paint struct pointers within the tile are stored as indices plus one.
+        std::vector<paint_struct> Structs;
+        std::vector<attached_paint_struct> AttachedStructs;
+        std::vector<uint16_t> QuadrantStructs;
+
+        // Session state after the tile was painted.
+        paint_struct* LastPS{};
+        attached_paint_struct* LastAttachedPS{};
+        const TileElement* SurfaceElement{};
+        const void* CurrentlyDrawnItem{};
+        const TileElement* PathElementOnSameHeight{};
+        const TileElement* TrackElementOnSameHeight{};
+        CoordsXY SpritePosition;
+        ViewportInteractionItem InteractionType{};
+        uint8_t Flags{};
+    };
+
+    // DPI position, size and zoom, rotation and view flags.
+    using ColumnKey = std::tuple<int32_t, int32_t, int32_t, int32_t, int8_t, uint8_t, uint32_t>;
+} // namespace
+
+class PaintTileCache
+{
+public:
+    uint32_t LastUsed{};
+    std::unordered_map<uint32_t, CachedTile> Tiles;
+    CachedTile* Current{};
+    PaintCacheRecording Recording;
+    std::vector<uint8_t> Snapshot;
+    std::vector<paint_struct*> ReplayedStructs;
+    std::vector<attached_paint_struct*> ReplayedAttachedStructs;
+};
+
+static std::map<ColumnKey, std::unique_ptr<PaintTileCache>> _columns;
+static std::atomic<uint32_t> _generation{ 1 };
+static uint32_t _columnsGeneration;
+static bool _columnsLandscapeSmoothing;
+static bool _columnsTransparentWater;
+static bool _columnsLightFx;
+static uint32_t _viewportCount;
+
+// Static initialisation happens on the main thread.
+static const std::thread::id _mainThreadId = std::this_thread::get_id();
+
+// Tiles with lights are only marked uncacheable while light effects are on.
+static bool IsLightFxAvailable()
+{
+#ifdef __ENABLE_LIGHTFX__
+    return lightfx_is_available();
+#else
+    return false;
+#endif
+}
+
+static bool IsPatrolAreaRendered()
+{
+    auto patrolAreaToRender = GetPatrolAreaToRender();
+    if (const auto* staffId = std::get_if<EntityId>(&patrolAreaToRender))
+    {
+        return !staffId->IsNull();
+    }
+    return true;
+}
+
+/**
+ * Tiles paint differently while these are active, so the cache is not used until they are turned off again.
+ */
+static bool IsTilePaintingModified(uint32_t viewFlags)
+{
+    // Clipping reads the clip selection, peep spawns are shown on the land ownership view.
+    if (viewFlags & VIEWPORT_FLAG_CLIP_VIEW)
+        return true;
+    if ((viewFlags & VIEWPORT_FLAG_LAND_OWNERSHIP) && ((gScreenFlags & SCREEN_FLAGS_SCENARIO_EDITOR) || gCheatsSandboxMode))
+        return true;
+
+    return gMapSelectFlags != 0 || gTrackDesignSaveMode || gPaintWidePathsAsGhost || gPaintBlockedTiles
+        || gShowSupportSegmentHeights || (gScreenFlags & (SCREEN_FLAGS_TRACK_DESIGNER | SCREEN_FLAGS_TRACK_MANAGER))
+        || virtual_floor_is_enabled() || IsPatrolAreaRendered();
+}
+
+static void PaintCacheEvictColumns()
+{
+    if (_columns.size() <= MaxColumns)
+        return;
+
+    std::vector<uint32_t> lastUsed;
+    lastUsed.reserve(_columns.size());
+    for (const auto& column : _columns)
+    {
+        lastUsed.push_back(column.second->LastUsed);
+    }
+    auto cutoff = lastUsed.begin() + (lastUsed.size() - MaxColumns);
+    std::nth_element(lastUsed.begin(), cutoff, lastUsed.end());
+
+    const auto threshold = *cutoff;
+    for (auto it = _columns.begin(); it != _columns.end();)
+    {
+        if (it->second->LastUsed < threshold)
+            it = _columns.erase(it);
+        else
+            ++it;
+    }
+}
+
+bool PaintCacheBeginViewport(uint32_t viewFlags)
+{
+    if (std::this_thread::get_id() != _mainThreadId)
+        return false;
+
+    if (!gConfigGeneral.cache_static_tiles)
+    {
+        _columns.clear();
+        return false;
+    }
+
+    const auto generation = _generation.load();
+    if (generation != _columnsGeneration || gConfigGeneral.landscape_smoothing != _columnsLandscapeSmoothing
+        || gConfigGeneral.transparent_water != _columnsTransparentWater || IsLightFxAvailable() != _columnsLightFx)
+    {
+        _columns.clear();
+        _columnsGeneration = generation;
+        _columnsLandscapeSmoothing = gConfigGeneral.landscape_smoothing;
+        _columnsTransparentWater = gConfigGeneral.transparent_water;
+        _columnsLightFx = IsLightFxAvailable();
+    }
+    PaintCacheEvictColumns();
+
+    if (IsTilePaintingModified(viewFlags))
+        return false;
+
+    _viewportCount++;
+    return true;
+}
+
+PaintTileCache* PaintCacheGetColumn(const paint_session& session)
+{
+    const auto& dpi = session.DPI;
+    const ColumnKey key{
+        dpi.x, dpi.y, dpi.width, dpi.height, static_cast<int8_t>(dpi.zoom_level), get_current_rotation(), session.ViewFlags,
+    };
+
+    auto& column = _columns[key];
+    if (column == nullptr)
+    {
+        column = std::make_unique<PaintTileCache>();
+    }
+    column->LastUsed = _viewportCount;
+    return column.get();
+}
+
+void PaintCacheInvalidate()
+{
+    _generation++;
+}
+
+static uint32_t PaintCacheTileKey(const CoordsXY& mapCoords)
+{
+    const TileCoordsXY tile(mapCoords);
+    return tile.y * MAXIMUM_MAP_SIZE_TECHNICAL + tile.x;
+}
+
+static void PaintCacheAppendElement(std::vector<uint8_t>& snapshot, const TileElement* element)
+{
+    if (element == nullptr)
+    {
+        snapshot.insert(snapshot.end(), sizeof(TileElement), 0);
+    }
+    else
+    {
+        const auto* bytes = reinterpret_cast<const uint8_t*>(element);
+        snapshot.insert(snapshot.end(), bytes, bytes + sizeof(TileElement));
+    }
+}
+
+static void PaintCacheTakeSnapshot(std::vector<uint8_t>& snapshot, const TileElement* element, const CoordsXY& mapCoords)
+{
+    snapshot.clear();
+    do
+    {
+        PaintCacheAppendElement(snapshot, element);
+    } while (!(element++)->IsLastForTile());
+
+    for (size_t i = 0; i < NumNeighbours; i++)
+    {
+        const auto position = mapCoords + CoordsDirectionDelta[i];
+        const TileElement* surface = nullptr;
+        if (map_is_location_valid(position))
+        {
+            surface = reinterpret_cast<const TileElement*>(map_get_surface_element_at(position));
+        }
+        PaintCacheAppendElement(snapshot, surface);
+    }
+}
+
+template<typename T> static bool PaintCacheEncode(T*& ptr, const std::vector<T*>& recorded)
+{
+    if (ptr == nullptr)
+        return true;
+
+    auto it = std::find(recorded.begin(), recorded.end(), ptr);
+    if (it == recorded.end())
+        return false;
+
+    ptr = reinterpret_cast<T*>(static_cast<uintptr_t>(it - recorded.begin() + 1));
+    return true;
+}
+
+template<typename T> static T* PaintCacheDecode(T* ptr, const std::vector<T*>& replayed)
+{
+    const auto index = reinterpret_cast<uintptr_t>(ptr);
+    return index == 0 ? nullptr : replayed[index - 1];
+}
+
+/**
+ * Copies the recorded paint structs into the tile, returns false if the tile depends on more than its elements.
+ */
+static bool PaintCacheStoreRecording(
+    const paint_session& session, const PaintCacheRecording& recording, CachedTile& tile, const CoordsXY& mapCoords)
+{
+    // Any paint struct created before ParentsReset means a previous paint struct was used, see PaintCacheCheckParent.
+    if ((session.Flags & PaintSessionFlags::Uncacheable) || recording.Structs.empty() || !recording.ParentsReset)
+        return false;
+    if (session.MapPosition != mapCoords)
+        return false;
+
+    // Elements at height zero do not reset the elements on the same height left by the previous tile.
+    const auto* firstElement = tile.FirstElement;
+    const auto* element = firstElement;
+    do
+    {
+        if (element->GetBaseZ() == 0)
+            return false;
+    } while (!(element++)->IsLastForTile());
+
+    const auto* lastElement = element;
+    auto isInTile = [firstElement, lastElement](const void* ptr) {
+        return ptr >= firstElement && ptr < lastElement;
+    };
+    if (!isInTile(session.SurfaceElement) || !isInTile(session.CurrentlyDrawnItem))
+        return false;
+    if (session.PathElementOnSameHeight != nullptr && !isInTile(session.PathElementOnSameHeight))
+        return false;
+    if (session.TrackElementOnSameHeight != nullptr && !isInTile(session.TrackElementOnSameHeight))
+        return false;
+
+    tile.Structs.clear();
+    for (const auto* ps : recording.Structs)
+    {
+        auto& cached = tile.Structs.emplace_back(*ps);
+        cached.next_quadrant_ps = nullptr;
+        if (!PaintCacheEncode(cached.children, recording.Structs)
+            || !PaintCacheEncode(cached.attached_ps, recording.AttachedStructs))
+            return false;
+    }
+
+    tile.AttachedStructs.clear();
+    for (const auto* ps : recording.AttachedStructs)
+    {
+        auto& cached = tile.AttachedStructs.emplace_back(*ps);
+        if (!PaintCacheEncode(cached.next, recording.AttachedStructs))
+            return false;
+    }
+
+    tile.QuadrantStructs.clear();
+    for (auto* ps : recording.QuadrantStructs)
+    {
+        auto it = std::find(recording.Structs.begin(), recording.Structs.end(), ps);
+        if (it == recording.Structs.end())
+            return false;
+        tile.QuadrantStructs.push_back(static_cast<uint16_t>(it - recording.Structs.begin()));
+    }
+
+    tile.LastPS = session.LastPS;
+    tile.LastAttachedPS = session.LastAttachedPS;
+    if (!PaintCacheEncode(tile.LastPS, recording.Structs)
+        || !PaintCacheEncode(tile.LastAttachedPS, recording.AttachedStructs))
+        return false;
+
+    tile.SurfaceElement = session.SurfaceElement;
+    tile.CurrentlyDrawnItem = session.CurrentlyDrawnItem;
+    tile.PathElementOnSameHeight = session.PathElementOnSameHeight;
+    tile.TrackElementOnSameHeight = session.TrackElementOnSameHeight;
+    tile.SpritePosition = session.SpritePosition;
+    tile.InteractionType = session.InteractionType;
+    tile.Flags = session.Flags;
+    return true;
+}
+
+static bool PaintCacheReplay(paint_session& session, PaintTileCache& column, const CachedTile& tile, const CoordsXY& mapCoords)
+{
+    auto& structs = column.ReplayedStructs;
+    structs.clear();
+    for (size_t i = 0; i < tile.Structs.size(); i++)
+    {
+        auto* entry = session.PaintEntryChain.Allocate();
+        if (entry == nullptr)
+            return false;
+        structs.push_back(entry->AsBasic());
+    }
+
+    auto& attachedStructs = column.ReplayedAttachedStructs;
+    attachedStructs.clear();
+    for (size_t i = 0; i < tile.AttachedStructs.size(); i++)
+    {
+        auto* entry = session.PaintEntryChain.Allocate();
+        if (entry == nullptr)
+            return false;
+        attachedStructs.push_back(entry->AsAttached());
+    }
+
+    for (size_t i = 0; i < structs.size(); i++)
+    {
+        auto* ps = structs[i];
+        *ps = tile.Structs[i];
+        ps->children = PaintCacheDecode(ps->children, structs);
+        ps->attached_ps = PaintCacheDecode(ps->attached_ps, attachedStructs);
+    }
+    for (size_t i = 0; i < attachedStructs.size(); i++)
+    {
+        auto* ps = attachedStructs[i];
+        *ps = tile.AttachedStructs[i];
+        ps->next = PaintCacheDecode(ps->next, attachedStructs);
+    }
+    for (auto index : tile.QuadrantStructs)
+    {
+        PaintSessionAddPSToQuadrant(session, structs[index]);
+    }
+
+    session.LastPS = PaintCacheDecode(tile.LastPS, structs);
+    session.LastAttachedPS = PaintCacheDecode(tile.LastAttachedPS, attachedStructs);
+    session.SurfaceElement = tile.SurfaceElement;
+    session.CurrentlyDrawnItem = tile.CurrentlyDrawnItem;
+    session.PathElementOnSameHeight = tile.PathElementOnSameHeight;
+    session.TrackElementOnSameHeight = tile.TrackElementOnSameHeight;
+    session.SpritePosition = tile.SpritePosition;
+    session.MapPosition = mapCoords;
+    session.InteractionType = tile.InteractionType;
+    session.Flags = tile.Flags;
+    return true;
+}
+
+bool PaintCacheTryReplayTile(paint_session& session, const CoordsXY& mapCoords)
+{
+    auto& column = *session.TileCache;
+    const auto* firstElement = map_get_first_element_at(mapCoords);
+    if (firstElement == nullptr)
+        return false;
+
+    auto& tile = column.Tiles[PaintCacheTileKey(mapCoords)];
+    PaintCacheTakeSnapshot(column.Snapshot, firstElement, mapCoords);
+    if (tile.FirstElement == firstElement && tile.Snapshot == column.Snapshot)
+    {
+        // Tiles that could not be cached are painted every time until their elements change.
+        return tile.Cacheable && PaintCacheReplay(session, column, tile, mapCoords);
+    }
+
+    tile.FirstElement = firstElement;
+    tile.Snapshot.swap(column.Snapshot);
+    tile.Cacheable = false;
+
+    auto& recording = column.Recording;
+    recording.Structs.clear();
+    recording.AttachedStructs.clear();
+    recording.QuadrantStructs.clear();
+    recording.ParentsReset = false;
+    column.Current = &tile;
+    session.CacheRecording = &recording;
+    return false;
+}
+
+void PaintCacheStoreTile(paint_session& session, const CoordsXY& mapCoords)
+{
+    auto& column = *session.TileCache;
+    auto& tile = *column.Current;
+    session.CacheRecording = nullptr;
+    column.Current = nullptr;
+
+    tile.Cacheable = PaintCacheStoreRecording(session, column.Recording, tile, mapCoords);
+    if (!tile.Cacheable)
+    {
+        tile.Structs.clear();
+        tile.AttachedStructs.clear();
+        tile.QuadrantStructs.clear();
+    }
+}
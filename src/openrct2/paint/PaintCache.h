@@ -0,0 +1,52 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2022 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+
+struct CoordsXY;
+struct paint_session;
+class PaintTileCache;
+
+/**
+ * Cross frame cache of the paint structs generated for map tiles. A viewport that does not move paints the same
+ * columns every frame, so each column keeps the paint structs of its tiles and replays them while the tile elements
+ * and the neighbouring surfaces are unchanged. Entities are always painted from scratch, as are tiles that depend on
+ * anything but their elements, such as animations, scrolling text, rides and entrances.
+ */
+
+/**
+ * Called before a window viewport is painted, returns false if tiles cannot be cached this time. The columns are not
+ * guarded, so this always returns false when not called on the main thread. Must be called while no columns are being
+ * painted.
+ */
+bool PaintCacheBeginViewport(uint32_t viewFlags);
+
+/**
+ * Returns the cache for the column painted by the session. Must be called on the main thread after the session's DPI
+ * has been set up for the column.
+ */
+PaintTileCache* PaintCacheGetColumn(const paint_session& session);
+
+/**
+ * Replays the tile from the session's column cache and returns true, otherwise returns false and the tile has to be
+ * painted. Recording starts if the tile has changed since it was last painted.
+ */
+bool PaintCacheTryReplayTile(paint_session& session, const CoordsXY& mapCoords);
+
+/**
+ * Stores the tile that was recorded since PaintCacheTryReplayTile.
+ */
+void PaintCacheStoreTile(paint_session& session, const CoordsXY& mapCoords);
+
+/**
+ * Drops every cached tile, called when the objects or the map are replaced.
+ */
+void PaintCacheInvalidate();
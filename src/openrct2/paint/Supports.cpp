@@ -592,6 +592,10 @@ bool wooden_a_supports_paint_setup(
 
             unk_supports_desc_bound_box bBox = byte_97B23C[special].bounding_box;
 
+            if (byte_97B23C[special].var_6 != 0)
+            {
+                session.Flags |= PaintSessionFlags::Uncacheable;
+            }
             if (byte_97B23C[special].var_6 == 0 || session.WoodenSupportsPrependTo == nullptr)
             {
                 PaintAddImageAsParent(
@@ -763,6 +767,10 @@ bool wooden_b_supports_paint_setup(
 
             const unk_supports_desc_bound_box& boundBox = supportsDesc.bounding_box;
 
+            if (supportsDesc.var_6 != 0)
+            {
+                session.Flags |= PaintSessionFlags::Uncacheable;
+            }
             if (supportsDesc.var_6 == 0 || session.WoodenSupportsPrependTo == nullptr)
             {
                 PaintAddImageAsParent(
@@ -1286,6 +1294,10 @@ bool path_a_supports_paint_setup(
         const unk_supports_desc& supportsDesc = byte_98D8D4[specialIndex];
         const unk_supports_desc_bound_box& boundBox = supportsDesc.bounding_box;
 
+        if (supportsDesc.var_6 != 0)
+        {
+            session.Flags |= PaintSessionFlags::Uncacheable;
+        }
         if (supportsDesc.var_6 == 0 || session.WoodenSupportsPrependTo == nullptr)
         {
             PaintAddImageAsParent(
@@ -84,6 +84,9 @@ static void PaintRideEntranceExitLightEffects(paint_session& session, int32_t he
 
     if (lightfx_is_available())
     {
+        // The lights are added while painting, a tile replayed from the paint cache would lose them.
+        session.Flags |= PaintSessionFlags::Uncacheable;
+
         if (entranceEl.GetEntranceType() == ENTRANCE_TYPE_RIDE_ENTRANCE)
         {
             lightfx_add_3d_light_magic_from_drawing_tile(session.MapPosition, 0, 0, height + 45, LightType::Lantern3);
@@ -258,6 +261,7 @@ static void PaintParkEntranceLightEffects(paint_session& session)
 
     if (lightfx_is_available())
     {
+        session.Flags |= PaintSessionFlags::Uncacheable;
         lightfx_add_3d_light_magic_from_drawing_tile(session.MapPosition, 0, 0, 155, LightType::Lantern3);
     }
 #endif
@@ -207,6 +207,8 @@ static void PaintLargeScenery3DText(
     if (banner == nullptr)
         return;
 
+    session.Flags |= PaintSessionFlags::Uncacheable;
+
     const auto* text = sceneryEntry.text;
     if (text == nullptr)
         return;
@@ -312,6 +314,8 @@ static void PaintLargeSceneryScrollingText(
     if (banner == nullptr)
         return;
 
+    session.Flags |= PaintSessionFlags::Uncacheable;
+
     auto ft = Formatter();
     banner->FormatTextTo(ft);
 
@@ -442,6 +442,7 @@ static void sub_6A4101(
         auto ride = get_ride(pathElement.GetRideIndex());
         if (direction < 2 && ride != nullptr && !imageTemplate.IsRemap())
         {
+            session.Flags |= PaintSessionFlags::Uncacheable;
             uint16_t scrollingMode = pathPaintInfo.ScrollingMode;
             scrollingMode += direction;
 
@@ -948,6 +949,9 @@ static void PaintLampLightEffects(paint_session& session, const PathElement& pat
             auto* pathAddEntry = pathEl.GetAdditionEntry();
             if (pathAddEntry != nullptr && pathAddEntry->flags & PATH_BIT_FLAG_LAMP)
             {
+                // The lights are added while painting, a tile replayed from the paint cache would lose them.
+                session.Flags |= PaintSessionFlags::Uncacheable;
+
                 if (!(pathEl.GetEdges() & EDGE_NE))
                 {
                     lightfx_add_3d_light_magic_from_drawing_tile(session.MapPosition, -16, 0, height + 23, LightType::Lantern3);
@@ -28,6 +28,7 @@
 #include "../../world/Scenery.h"
 #include "../../world/Surface.h"
 #include "../Paint.h"
+#include "../PaintCache.h"
 #include "../Supports.h"
 #include "../VirtualFloor.h"
 #include "Paint.Surface.h"
@@ -59,7 +60,21 @@ void tile_element_paint_setup(paint_session& session, const CoordsXY& mapCoords,
         session.Flags = isTrackPiecePreview ? PaintSessionFlags::IsTrackPiecePreview : 0;
         session.WaterHeight = 0xFFFF;
 
+#ifndef __TESTPAINT__
+        if (session.TileCache != nullptr && !isTrackPiecePreview && PaintCacheTryReplayTile(session, mapCoords))
+        {
+            return;
+        }
+#endif // __TESTPAINT__
+
         PaintTileElementBase(session, mapCoords);
+
+#ifndef __TESTPAINT__
+        if (session.CacheRecording != nullptr)
+        {
+            PaintCacheStoreTile(session, mapCoords);
+        }
+#endif // __TESTPAINT__
     }
     else if (!(session.ViewFlags & VIEWPORT_FLAG_TRANSPARENT_BACKGROUND))
     {
@@ -274,12 +289,14 @@ static void PaintTileElementBase(paint_session& session, const CoordsXY& origCoo
                 PaintPath(session, baseZ, *(tile_element->AsPath()));
                 break;
             case TileElementType::Track:
+                session.Flags |= PaintSessionFlags::Uncacheable;
                 PaintTrack(session, direction, baseZ, *(tile_element->AsTrack()));
                 break;
             case TileElementType::SmallScenery:
                 PaintSmallScenery(session, direction, baseZ, *(tile_element->AsSmallScenery()));
                 break;
             case TileElementType::Entrance:
+                session.Flags |= PaintSessionFlags::Uncacheable;
                 PaintEntrance(session, direction, baseZ, *(tile_element->AsEntrance()));
                 break;
             case TileElementType::Wall:
@@ -289,6 +306,7 @@ static void PaintTileElementBase(paint_session& session, const CoordsXY& origCoo
                 PaintLargeScenery(session, direction, baseZ, *(tile_element->AsLargeScenery()));
                 break;
             case TileElementType::Banner:
+                session.Flags |= PaintSessionFlags::Uncacheable;
                 PaintBanner(session, direction, baseZ, *(tile_element->AsBanner()));
                 break;
         }
@@ -75,6 +75,8 @@ namespace PaintSessionFlags
 {
     constexpr uint8_t PassedSurface = 1u << 0;
     constexpr uint8_t IsTrackPiecePreview = 1u << 1;
+    // The tile depends on more than its elements, so the paint cache must not replay it.
+    constexpr uint8_t Uncacheable = 1u << 2;
 } // namespace PaintSessionFlags
 
 #ifdef __TESTPAINT__
@@ -158,6 +158,10 @@ static void PaintWallWall(
 {
     PROFILED_FUNCTION();
 
+    if (wallEntry.flags2 & WALL_SCENERY_2_ANIMATED)
+    {
+        session.Flags |= PaintSessionFlags::Uncacheable;
+    }
     auto frameNum = (wallEntry.flags2 & WALL_SCENERY_2_ANIMATED) ? (gCurrentTicks & 7) * 2 : 0;
     auto imageIndex = wallEntry.image + imageOffset + frameNum;
     PaintAddImageAsParent(session, imageTemplate.WithIndex(imageIndex), offset, bounds, boundsOffset);
@@ -189,6 +193,8 @@ static void PaintWallScrollingText(
     if (banner == nullptr)
         return;
 
+    session.Flags |= PaintSessionFlags::Uncacheable;
+
     auto textColour = isGhost ? static_cast<colour_t>(COLOUR_GREY) : wallElement.GetSecondaryColour();
     auto textPaletteIndex = direction == 0 ? ColourMapA[textColour].mid_dark : ColourMapA[textColour].light;
 
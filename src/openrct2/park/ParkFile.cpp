@@ -16,6 +16,8 @@
 #include "../OpenRCT2.h"
 #include "../ParkImporter.h"
 #include "../Version.h"
+#include "../config/Config.h"
+#include "../core/Compression.h"
 #include "../core/Console.hpp"
 #include "../core/Crypt.h"
 #include "../core/DataSerialiser.h"
@@ -98,6 +100,7 @@ namespace OpenRCT2
     public:
         ObjectList RequiredObjects;
         std::vector<const ObjectRepositoryItem*> ExportObjectsList;
+        std::optional<CompressionType> SaveCompression;
         bool OmitTracklessRides{};
 
     private:
@@ -124,6 +127,7 @@ namespace OpenRCT2
         void Import()
         {
             auto& os = *_os;
+            os.DecompressAllChunks();
             ReadWriteTilesChunk(os);
             ReadWriteBannersChunk(os);
             ReadWriteRidesChunk(os);
@@ -150,6 +154,7 @@ namespace OpenRCT2
         void Save(IStream& stream)
         {
             OrcaStream os(stream, OrcaStream::Mode::WRITING);
+            os.SetCompression(SaveCompression.value_or(GetSaveCompression()), GetSaveCompressionLevel());
 
             auto& header = os.GetHeader();
             header.Magic = PARK_FILE_MAGIC;
@@ -426,7 +431,7 @@ namespace OpenRCT2
 
         void ReadWriteGeneralChunk(OrcaStream& os)
         {
-            auto found = os.ReadWriteChunk(ParkFileChunkType::GENERAL, [this](OrcaStream::ChunkStream& cs) {
+            auto found = os.ReadWriteChunk(ParkFileChunkType::GENERAL, [this, &os](OrcaStream::ChunkStream& cs) {
                 // Only GAME_PAUSED_NORMAL from gGamePaused is relevant.
                 if (cs.GetMode() == OrcaStream::Mode::READING)
                 {
@@ -477,6 +482,22 @@ namespace OpenRCT2
                 cs.ReadWrite(gWidePathTileLoopPosition);
 
                 ReadWriteRideRatingCalculationData(cs, gRideRatingUpdateState);
+
+                // 0xC introduced dirty tile tracking for the path wide flags, older parks keep the sweep.
+                if (os.GetHeader().TargetVersion >= 0xC)
+                {
+                    cs.ReadWrite(gWidePathUseDirtyTiles);
+                    auto dirtyTiles = map_get_path_wide_dirty_tiles();
+                    cs.ReadWriteVector(dirtyTiles, [&cs](TileCoordsXY& tile) { cs.ReadWrite(tile); });
+                    if (cs.GetMode() == OrcaStream::Mode::READING)
+                    {
+                        map_set_path_wide_dirty_tiles(dirtyTiles);
+                    }
+                }
+                else
+                {
+                    gWidePathUseDirtyTiles = false;
+                }
             });
             if (!found)
             {
@@ -2218,11 +2239,30 @@ namespace OpenRCT2
             }
         });
     }
+
+    CompressionType GetSaveCompression()
+    {
+        if (!gCustomCompression.empty())
+        {
+            auto type = Compression::ParseType(gCustomCompression);
+            if (type.has_value())
+            {
+                return *type;
+            }
+        }
+        return gConfigGeneral.save_compression;
+    }
+
+    int32_t GetSaveCompressionLevel()
+    {
+        return gCustomCompressionLevel.value_or(gConfigGeneral.save_compression_level);
+    }
 } // namespace OpenRCT2
 
 void ParkFileExporter::Export(std::string_view path)
 {
     auto parkFile = std::make_unique<OpenRCT2::ParkFile>();
+    parkFile->SaveCompression = SaveCompression;
     parkFile->Save(path);
 }
 
@@ -2230,6 +2270,7 @@ void ParkFileExporter::Export(IStream& stream)
 {
     auto parkFile = std::make_unique<OpenRCT2::ParkFile>();
     parkFile->ExportObjectsList = ExportObjectsList;
+    parkFile->SaveCompression = SaveCompression;
     parkFile->Save(stream);
 }
 
@@ -1,27 +1,37 @@
 #pragma once
 
+#include <cstdint>
+#include <optional>
 #include <string_view>
 #include <vector>
 
 struct ObjectRepositoryItem;
+enum class CompressionType : uint32_t;
 
 namespace OpenRCT2
 {
     // Current version that is saved.
-    constexpr uint32_t PARK_FILE_CURRENT_VERSION = 0xA;
+    constexpr uint32_t PARK_FILE_CURRENT_VERSION = 0xC;
 
     // The minimum version that is forwards compatible with the current version.
-    constexpr uint32_t PARK_FILE_MIN_VERSION = 0x9;
+    // 0xB introduced per chunk compression which older versions can not read.
+    constexpr uint32_t PARK_FILE_MIN_VERSION = 0xB;
 
     constexpr uint32_t PARK_FILE_MAGIC = 0x4B524150; // PARK
 
     struct IStream;
+
+    // Compression used for park files, network maps and replays, the command line overrides the config.
+    CompressionType GetSaveCompression();
+    int32_t GetSaveCompressionLevel();
 } // namespace OpenRCT2
 
 class ParkFileExporter
 {
 public:
     std::vector<const ObjectRepositoryItem*> ExportObjectsList;
+    // Overrides the configured compression when set.
+    std::optional<CompressionType> SaveCompression;
 
     void Export(std::string_view path);
     void Export(OpenRCT2::IStream& stream);
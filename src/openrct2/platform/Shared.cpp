@@ -19,6 +19,7 @@
 #include "../core/File.h"
 #include "../core/Path.hpp"
 #include "../localisation/Localisation.h"
+#include "../paint/Paint.h"
 #include "Platform.h"
 
 #include <algorithm>
@@ -42,6 +43,7 @@ namespace Platform
             InitTicks();
             bitcount_init();
             mask_init();
+            PaintSortInit();
         }
     }
 
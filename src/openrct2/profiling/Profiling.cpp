@@ -9,109 +9,543 @@
 
 #include "Profiling.h"
 
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <chrono>
 #include <fstream>
 #include <iomanip>
-#include <stack>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#    include <intrin.h>
+#    define PROFILING_USE_RDTSC
+#elif defined(__x86_64__) || defined(__i386__)
+#    include <x86intrin.h>
+#    define PROFILING_USE_RDTSC
+#endif
 
 namespace OpenRCT2::Profiling
 {
-    inline static bool _enabled = false;
+    static std::atomic<bool> _enabled{};
 
     void Enable()
     {
-        _enabled = true;
+        _enabled.store(true, std::memory_order_relaxed);
     }
 
     void Disable()
     {
-        _enabled = false;
+        _enabled.store(false, std::memory_order_relaxed);
     }
 
     bool IsEnabled()
     {
-        return _enabled;
+        return _enabled.load(std::memory_order_relaxed);
     }
 
     namespace Detail
     {
-        using Clock = std::chrono::high_resolution_clock;
-        using Tp = Clock::time_point;
+        using Clock = std::chrono::steady_clock;
 
-        struct FunctionEntry
+        // Calls are timed with the time stamp counter where the CPU has one, reading it costs a fraction of reading
+        // a clock. Ticks are only converted to nanoseconds when the data is read.
+#ifdef PROFILING_USE_RDTSC
+        static uint64_t ReadTicks()
+        {
+            return __rdtsc();
+        }
+
+        struct TickReference
+        {
+            uint64_t Ticks;
+            Clock::time_point Time;
+        };
+        static const TickReference _tickReference{ ReadTicks(), Clock::now() };
+
+        // Measured over the time since the profiler was loaded, so the rate is accurate by the time anything reads it.
+        static double GetNanosecondsPerTick()
+        {
+            const auto ticks = ReadTicks() - _tickReference.Ticks;
+            const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - _tickReference.Time);
+            if (ticks == 0 || ns.count() <= 0)
+                return 1.0;
+            return static_cast<double>(ns.count()) / ticks;
+        }
+#else
+        static uint64_t ReadTicks()
+        {
+            return static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count());
+        }
+
+        static double GetNanosecondsPerTick()
+        {
+            return 1.0;
+        }
+#endif
+
+        static double TicksToMicroseconds(uint64_t ticks)
+        {
+            return ticks * GetNanosecondsPerTick() / 1000.0;
+        }
+
+        // Functions past this many are not profiled.
+        static constexpr size_t MaxFunctions = 1024;
+
+        // Calls nested deeper than this are not profiled.
+        static constexpr size_t MaxCallDepth = 256;
+
+        // Size of the hash table recording which function called which, further call edges are not recorded.
+        static constexpr size_t MaxCallEdges = 4096;
+        static_assert((MaxCallEdges & (MaxCallEdges - 1)) == 0);
+
+        /**
+         * The statistics of one function on one thread. Only the owning thread writes, so the atomics are
+         * updated with plain loads and stores instead of read-modify-writes; they only make reads safe.
+         */
+        struct FunctionStats
+        {
+            std::atomic<uint64_t> CallCount{};
+            std::atomic<uint64_t> TotalTicks{};
+            std::atomic<uint64_t> MinTicks{ std::numeric_limits<uint64_t>::max() };
+            std::atomic<uint64_t> MaxTicks{};
+            std::atomic<uint64_t> SampleCount{};
+            std::array<std::atomic<uint64_t>, MaxSamplesSize> SamplesTicks{};
+        };
+
+        static void Increase(std::atomic<uint64_t>& value, uint64_t amount)
+        {
+            value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+        }
+
+        struct CallFrame
         {
-            FunctionInternal* Parent;
             FunctionInternal* Func;
-            Tp EntryTime;
+            uint64_t EntryTicks;
+        };
+
+        /**
+         * Everything the profiler records about one thread. Threads never share a profile, so calls on
+         * worker threads do not contend; the profiles are merged when the data is read.
+         */
+        struct ThreadProfile
+        {
+            std::array<std::atomic<FunctionStats*>, MaxFunctions> Stats{};
+
+            // Open addressing set of (caller index + 1) << 16 | (callee index + 1), zero marks an empty slot.
+            std::array<std::atomic<uint32_t>, MaxCallEdges> CallEdges{};
+
+            // Data recorded before the last ResetData is cleared by the owning thread on its next call.
+            std::atomic<uint32_t> ResetGeneration{};
+
+            std::array<CallFrame, MaxCallDepth> CallStack;
+            size_t CallDepth{};
+
+            ThreadProfile() = default;
+            ThreadProfile(const ThreadProfile&) = delete;
+
+            ~ThreadProfile()
+            {
+                for (auto& stats : Stats)
+                {
+                    delete stats.load();
+                }
+            }
+
+            FunctionStats* GetStats(const FunctionInternal& func)
+            {
+                if (func.Index >= MaxFunctions)
+                    return nullptr;
+
+                auto* stats = Stats[func.Index].load(std::memory_order_relaxed);
+                if (stats == nullptr)
+                {
+                    stats = new FunctionStats();
+                    Stats[func.Index].store(stats, std::memory_order_release);
+                }
+                return stats;
+            }
+
+            void AddCallEdge(const FunctionInternal& caller, const FunctionInternal& callee)
+            {
+                if (caller.Index >= MaxFunctions || callee.Index >= MaxFunctions)
+                    return;
+
+                const auto key = ((caller.Index + 1) << 16) | (callee.Index + 1);
+                auto slot = (key * 2654435761u) & (MaxCallEdges - 1);
+                for (size_t i = 0; i < MaxCallEdges; i++)
+                {
+                    const auto existing = CallEdges[slot].load(std::memory_order_relaxed);
+                    if (existing == key)
+                        return;
+                    if (existing == 0)
+                    {
+                        CallEdges[slot].store(key, std::memory_order_relaxed);
+                        return;
+                    }
+                    slot = (slot + 1) & (MaxCallEdges - 1);
+                }
+            }
 
-            FunctionEntry(FunctionInternal* parent, FunctionInternal* func, const Tp& entryTime)
-                : Parent(parent)
-                , Func(func)
-                , EntryTime(entryTime)
+            void Reset(uint32_t generation)
             {
+                for (auto& stats : Stats)
+                {
+                    auto* functionStats = stats.load(std::memory_order_relaxed);
+                    if (functionStats != nullptr)
+                    {
+                        functionStats->CallCount.store(0, std::memory_order_relaxed);
+                        functionStats->TotalTicks.store(0, std::memory_order_relaxed);
+                        functionStats->MinTicks.store(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
+                        functionStats->MaxTicks.store(0, std::memory_order_relaxed);
+                        functionStats->SampleCount.store(0, std::memory_order_relaxed);
+                    }
+                }
+                for (auto& edge : CallEdges)
+                {
+                    edge.store(0, std::memory_order_relaxed);
+                }
+                ResetGeneration.store(generation, std::memory_order_release);
             }
         };
 
-        static thread_local std::stack<FunctionEntry> _callStack;
+        static std::atomic<uint32_t> _resetGeneration{};
+        static std::mutex _threadProfilesMutex;
 
-        void FunctionEnter(Function& func)
+        // Profiles are kept after their thread ends so that its calls still count.
+        static std::vector<std::unique_ptr<ThreadProfile>> _threadProfiles;
+        static thread_local ThreadProfile* _threadProfile;
+
+        static ThreadProfile& GetThreadProfile()
         {
-            const auto entryTime = Clock::now();
+            auto* profile = _threadProfile;
+            if (profile == nullptr)
+            {
+                std::scoped_lock lock(_threadProfilesMutex);
+                profile = _threadProfiles.emplace_back(std::make_unique<ThreadProfile>()).get();
+                profile->ResetGeneration = _resetGeneration.load();
+                _threadProfile = profile;
+            }
 
-            auto& funcInternal = static_cast<FunctionInternal&>(func);
-            funcInternal.CallCount++;
+            const auto generation = _resetGeneration.load(std::memory_order_relaxed);
+            if (profile->ResetGeneration.load(std::memory_order_relaxed) != generation)
+            {
+                profile->Reset(generation);
+            }
+            return *profile;
+        }
 
-            FunctionInternal* parent = nullptr;
+        // Calls fn with the statistics each thread recorded for the function since the last reset.
+        template<typename TFn> static void ForEachThreadStats(const FunctionInternal& func, TFn&& fn)
+        {
+            if (func.Index >= MaxFunctions)
+                return;
 
-            if (!_callStack.empty())
-                parent = _callStack.top().Func;
+            std::scoped_lock lock(_threadProfilesMutex);
+            const auto generation = _resetGeneration.load();
+            for (const auto& profile : _threadProfiles)
+            {
+                if (profile->ResetGeneration.load(std::memory_order_acquire) != generation)
+                    continue;
+
+                const auto* stats = profile->Stats[func.Index].load(std::memory_order_acquire);
+                if (stats != nullptr && stats->CallCount.load(std::memory_order_relaxed) != 0)
+                {
+                    fn(*stats);
+                }
+            }
+        }
+
+        static std::vector<Function*> GetCallEdgeFunctions(const FunctionInternal& func, bool callers)
+        {
+            const auto& registry = GetRegistry();
+            std::vector<bool> found(registry.size());
+            {
+                std::scoped_lock lock(_threadProfilesMutex);
+                const auto generation = _resetGeneration.load();
+                for (const auto& profile : _threadProfiles)
+                {
+                    if (profile->ResetGeneration.load(std::memory_order_acquire) != generation)
+                        continue;
+
+                    for (const auto& edge : profile->CallEdges)
+                    {
+                        const auto key = edge.load(std::memory_order_relaxed);
+                        if (key == 0)
+                            continue;
+
+                        const auto callerIndex = (key >> 16) - 1;
+                        const auto calleeIndex = (key & 0xFFFF) - 1;
+                        const auto otherIndex = callers ? callerIndex : calleeIndex;
+                        if ((callers ? calleeIndex : callerIndex) == func.Index && otherIndex < found.size())
+                        {
+                            found[otherIndex] = true;
+                        }
+                    }
+                }
+            }
 
-            _callStack.emplace(parent, &funcInternal, entryTime);
+            std::vector<Function*> result;
+            for (size_t i = 0; i < found.size(); i++)
+            {
+                if (found[i])
+                {
+                    result.push_back(registry[i]);
+                }
+            }
+            return result;
+        }
+
+        uint64_t FunctionInternal::GetCallCount() const noexcept
+        {
+            uint64_t callCount = 0;
+            ForEachThreadStats(*this, [&](const FunctionStats& stats) { callCount += stats.CallCount.load(); });
+            return callCount;
+        }
+
+        std::vector<double> FunctionInternal::GetTimeSamples() const
+        {
+            std::vector<double> samples;
+            const auto usPerTick = GetNanosecondsPerTick() / 1000.0;
+            ForEachThreadStats(*this, [&](const FunctionStats& stats) {
+                // Oldest first, once the window is full the oldest sample is the next one to be overwritten.
+                const auto sampleCount = stats.SampleCount.load(std::memory_order_acquire);
+                const auto numSamples = std::min<uint64_t>(sampleCount, MaxSamplesSize);
+                for (uint64_t i = sampleCount - numSamples; i < sampleCount; i++)
+                {
+                    samples.push_back(stats.SamplesTicks[i % MaxSamplesSize].load(std::memory_order_relaxed) * usPerTick);
+                }
+            });
+            if (samples.size() > MaxSamplesSize)
+            {
+                samples.erase(samples.begin(), samples.end() - MaxSamplesSize);
+            }
+            return samples;
+        }
+
+        double FunctionInternal::GetTotalTime() const
+        {
+            uint64_t totalTicks = 0;
+            ForEachThreadStats(*this, [&](const FunctionStats& stats) { totalTicks += stats.TotalTicks.load(); });
+            return TicksToMicroseconds(totalTicks);
+        }
+
+        double FunctionInternal::GetMinTime() const
+        {
+            auto minTicks = std::numeric_limits<uint64_t>::max();
+            ForEachThreadStats(
+                *this, [&](const FunctionStats& stats) { minTicks = std::min(minTicks, stats.MinTicks.load()); });
+            return minTicks == std::numeric_limits<uint64_t>::max() ? 0.0 : TicksToMicroseconds(minTicks);
+        }
+
+        double FunctionInternal::GetMaxTime() const
+        {
+            uint64_t maxTicks = 0;
+            ForEachThreadStats(
+                *this, [&](const FunctionStats& stats) { maxTicks = std::max(maxTicks, stats.MaxTicks.load()); });
+            return TicksToMicroseconds(maxTicks);
+        }
+
+        std::vector<Function*> FunctionInternal::GetParents() const
+        {
+            return GetCallEdgeFunctions(*this, true);
+        }
+
+        std::vector<Function*> FunctionInternal::GetChildren() const
+        {
+            return GetCallEdgeFunctions(*this, false);
         }
 
-        void FunctionExit(Function& func)
+        struct TraceEvent
         {
-            const auto exitTime = Clock::now();
+            const Function* Func;
+            uint64_t StartTicks;
+            uint64_t DurationTicks;
+        };
 
-            assert(!_callStack.empty());
+        /**
+         * The events recorded by one thread. Only that thread appends, chunks are published with their count
+         * and never move or get freed while the buffer lives, so a trace can be exported without stopping it.
+         */
+        struct TraceBuffer
+        {
+            static constexpr size_t ChunkSize = 4096;
 
-            auto& stackEntry = _callStack.top();
+            // Caps a thread at about 2 million events, 48 MiB, further events are counted as dropped.
+            static constexpr size_t MaxChunks = 512;
 
-            const auto deltaTime = exitTime - stackEntry.EntryTime;
+            struct Chunk
+            {
+                std::array<TraceEvent, ChunkSize> Events;
+                std::atomic<size_t> Count{};
+                std::atomic<Chunk*> Next{};
+            };
+
+            Chunk* First = new Chunk();
+            Chunk* Last = First;
+            size_t NumChunks = 1;
+            std::atomic<uint64_t> Dropped{};
+            uint32_t ThreadIndex{};
+            std::string ThreadName;
+
+            TraceBuffer() = default;
+            TraceBuffer(const TraceBuffer&) = delete;
+
+            ~TraceBuffer()
+            {
+                auto* chunk = First;
+                while (chunk != nullptr)
+                {
+                    auto* next = chunk->Next.load();
+                    delete chunk;
+                    chunk = next;
+                }
+            }
 
-            // Elapsed microseconds.
-            const auto elapsedTimeUs = std::chrono::duration_cast<std::chrono::nanoseconds>(deltaTime).count() / 1000.0;
+            void Append(const TraceEvent& event)
+            {
+                auto count = Last->Count.load(std::memory_order_relaxed);
+                if (count == ChunkSize)
+                {
+                    if (NumChunks == MaxChunks)
+                    {
+                        Dropped.fetch_add(1, std::memory_order_relaxed);
+                        return;
+                    }
+                    auto* chunk = new Chunk();
+                    Last->Next.store(chunk, std::memory_order_release);
+                    Last = chunk;
+                    NumChunks++;
+                    count = 0;
+                }
+                Last->Events[count] = event;
+                Last->Count.store(count + 1, std::memory_order_release);
+            }
 
-            auto* funcData = stackEntry.Func;
+            template<typename TFn> void ForEach(TFn&& fn) const
+            {
+                for (auto* chunk = First; chunk != nullptr; chunk = chunk->Next.load(std::memory_order_acquire))
+                {
+                    const auto count = chunk->Count.load(std::memory_order_acquire);
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        fn(chunk->Events[i]);
+                    }
+                }
+            }
+        };
 
-            // We don't need a lock for this, we only have a fixed window.
-            const auto sampleEntryIdx = funcData->SampleIterator++ % funcData->Samples.size();
-            funcData->Samples[sampleEntryIdx] = elapsedTimeUs;
+        static std::atomic<bool> _tracing{};
+        static std::atomic<uint64_t> _traceStartTicks{};
+        static std::mutex _traceMutex;
+        static std::atomic<uint32_t> _traceSession{};
+        static std::vector<std::shared_ptr<TraceBuffer>> _traceBuffers;
 
-            if (stackEntry.Parent)
+        // Threads keep their own reference, a buffer dropped by a new trace stays valid until they move on.
+        struct ThreadTrace
+        {
+            std::shared_ptr<TraceBuffer> Buffer;
+            uint32_t Session{};
+            std::string Name;
+        };
+        static thread_local ThreadTrace _threadTrace;
+
+        static TraceBuffer& GetTraceBuffer()
+        {
+            std::scoped_lock lock(_traceMutex);
+            if (_threadTrace.Buffer == nullptr || _threadTrace.Session != _traceSession)
             {
-                std::scoped_lock lock(stackEntry.Parent->Mutex);
-                stackEntry.Parent->Children.insert(funcData);
+                auto buffer = std::make_shared<TraceBuffer>();
+                buffer->ThreadIndex = static_cast<uint32_t>(_traceBuffers.size());
+                buffer->ThreadName = _threadTrace.Name;
+                _traceBuffers.push_back(buffer);
+                _threadTrace.Buffer = std::move(buffer);
+                _threadTrace.Session = _traceSession;
             }
+            return *_threadTrace.Buffer;
+        }
+
+        static void ResetTrace()
+        {
+            std::scoped_lock lock(_traceMutex);
+            _traceBuffers.clear();
+            _traceSession++;
+            _traceStartTicks = ReadTicks();
+        }
 
-            // This requires locking.
+        static void RecordTraceEvent(const Function* func, uint64_t entryTicks, uint64_t exitTicks)
+        {
+            if (entryTicks < _traceStartTicks.load(std::memory_order_relaxed))
+                return;
+
+            // Only the first event of a thread in each trace needs the lock.
+            auto* buffer = _threadTrace.Buffer.get();
+            if (buffer == nullptr || _threadTrace.Session != _traceSession.load(std::memory_order_relaxed))
             {
-                std::scoped_lock lock(funcData->Mutex);
+                buffer = &GetTraceBuffer();
+            }
+            buffer->Append({ func, entryTicks, exitTicks - entryTicks });
+        }
+
+        void FunctionEnter(Function& func)
+        {
+            auto& profile = GetThreadProfile();
+            if (profile.CallDepth < MaxCallDepth)
+            {
+                auto& funcInternal = static_cast<FunctionInternal&>(func);
+                auto* stats = profile.GetStats(funcInternal);
+                if (stats != nullptr)
+                {
+                    Increase(stats->CallCount, 1);
+                }
+                profile.CallStack[profile.CallDepth] = { &funcInternal, ReadTicks() };
+            }
+            profile.CallDepth++;
+        }
+
+        void FunctionExit([[maybe_unused]] Function& func)
+        {
+            const auto exitTicks = ReadTicks();
+
+            auto& profile = *_threadProfile;
+            assert(profile.CallDepth > 0);
+            profile.CallDepth--;
+            if (profile.CallDepth >= MaxCallDepth)
+                return;
 
-                if (stackEntry.Parent)
-                    funcData->Parents.insert(stackEntry.Parent);
+            const auto& frame = profile.CallStack[profile.CallDepth];
+            assert(frame.Func == &func);
 
-                if (funcData->MinTimeUs == 0.0)
-                    funcData->MinTimeUs = elapsedTimeUs;
-                else
-                    funcData->MinTimeUs = std::min(elapsedTimeUs, funcData->MinTimeUs);
+            auto* stats = profile.GetStats(*frame.Func);
+            if (stats != nullptr)
+            {
+                const auto elapsedTicks = exitTicks - frame.EntryTicks;
+
+                Increase(stats->TotalTicks, elapsedTicks);
+                if (elapsedTicks < stats->MinTicks.load(std::memory_order_relaxed))
+                    stats->MinTicks.store(elapsedTicks, std::memory_order_relaxed);
+                if (elapsedTicks > stats->MaxTicks.load(std::memory_order_relaxed))
+                    stats->MaxTicks.store(elapsedTicks, std::memory_order_relaxed);
 
-                funcData->MaxTimeUs = std::max(elapsedTimeUs, funcData->MaxTimeUs);
-                funcData->TotalTimeUs += elapsedTimeUs;
+                const auto sampleCount = stats->SampleCount.load(std::memory_order_relaxed);
+                stats->SamplesTicks[sampleCount % MaxSamplesSize].store(elapsedTicks, std::memory_order_relaxed);
+                stats->SampleCount.store(sampleCount + 1, std::memory_order_release);
+            }
+
+            if (profile.CallDepth > 0)
+            {
+                profile.AddCallEdge(*profile.CallStack[profile.CallDepth - 1].Func, *frame.Func);
             }
 
-            _callStack.pop();
+            if (_tracing.load(std::memory_order_relaxed))
+            {
+                RecordTraceEvent(frame.Func, frame.EntryTicks, exitTicks);
+            }
         }
 
         std::vector<Function*>& GetRegistry()
@@ -129,18 +563,9 @@ namespace OpenRCT2::Profiling
 
     void ResetData()
     {
-        for (auto* func : Detail::GetRegistry())
-        {
-            auto* funcInternal = static_cast<Detail::FunctionInternal*>(func);
-
-            std::scoped_lock lock(funcInternal->Mutex);
-            funcInternal->CallCount = 0;
-            funcInternal->MinTimeUs = 0.0;
-            funcInternal->MaxTimeUs = 0.0;
-            funcInternal->SampleIterator = 0;
-            funcInternal->Children.clear();
-            funcInternal->Parents.clear();
-        }
+        // Each thread clears its own data on its next profiled call, until then readers skip it.
+        Detail::_resetGeneration++;
+        Detail::ResetTrace();
     }
 
     bool ExportCSV(const std::string& filePath)
@@ -171,4 +596,105 @@ namespace OpenRCT2::Profiling
         return true;
     }
 
+    void StartTrace()
+    {
+        Detail::ResetTrace();
+        Detail::_tracing = true;
+    }
+
+    void StopTrace()
+    {
+        Detail::_tracing = false;
+    }
+
+    bool IsTracing()
+    {
+        return Detail::_tracing;
+    }
+
+    void SetThreadName(std::string_view name)
+    {
+        Detail::_threadTrace.Name = name;
+    }
+
+    static void WriteJsonString(std::ostream& out, std::string_view str)
+    {
+        out << '"';
+        for (auto c : str)
+        {
+            if (c == '"' || c == '\\')
+            {
+                out << '\\' << c;
+            }
+            else if (static_cast<unsigned char>(c) < 0x20)
+            {
+                out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int32_t>(c) << std::dec;
+            }
+            else
+            {
+                out << c;
+            }
+        }
+        out << '"';
+    }
+
+    // Trace event timestamps are in microseconds, written with nanosecond precision.
+    static void WriteMicroseconds(std::ostream& out, int64_t ns)
+    {
+        out << ns / 1000 << '.' << std::setw(3) << std::setfill('0') << ns % 1000;
+    }
+
+    void WriteTrace(std::ostream& out)
+    {
+        std::vector<std::shared_ptr<Detail::TraceBuffer>> buffers;
+        uint64_t startTicks;
+        {
+            std::scoped_lock lock(Detail::_traceMutex);
+            buffers = Detail::_traceBuffers;
+            startTicks = Detail::_traceStartTicks;
+        }
+        const auto nsPerTick = Detail::GetNanosecondsPerTick();
+
+        std::unordered_map<const Function*, std::string> names;
+        uint64_t dropped = 0;
+        out << "{\"traceEvents\":[\n";
+        out << R"({"ph":"M","name":"process_name","pid":1,"tid":0,"args":{"name":"OpenRCT2"}})";
+        for (const auto& buffer : buffers)
+        {
+            const auto tid = buffer->ThreadIndex;
+            auto threadName = buffer->ThreadName.empty() ? "Thread " + std::to_string(tid) : buffer->ThreadName;
+            out << ",\n" << R"({"ph":"M","name":"thread_name","pid":1,"tid":)" << tid << R"(,"args":{"name":)";
+            WriteJsonString(out, threadName);
+            out << "}}";
+
+            buffer->ForEach([&](const Detail::TraceEvent& event) {
+                auto it = names.find(event.Func);
+                if (it == names.end())
+                {
+                    std::ostringstream name;
+                    WriteJsonString(name, event.Func->GetName());
+                    it = names.emplace(event.Func, name.str()).first;
+                }
+                out << ",\n" << R"({"ph":"X","cat":"function","pid":1,"tid":)" << tid << R"(,"name":)" << it->second;
+                out << R"(,"ts":)";
+                WriteMicroseconds(out, static_cast<int64_t>((event.StartTicks - startTicks) * nsPerTick));
+                out << R"(,"dur":)";
+                WriteMicroseconds(out, static_cast<int64_t>(event.DurationTicks * nsPerTick));
+                out << "}";
+            });
+            dropped += buffer->Dropped.load();
+        }
+        out << "\n],\"displayTimeUnit\":\"ms\",\"otherData\":{\"droppedEvents\":" << dropped << "}}\n";
+    }
+
+    bool ExportTrace(const std::string& filePath)
+    {
+        std::ofstream out(filePath);
+        if (!out.is_open())
+            return false;
+
+        WriteTrace(out);
+        return out.good();
+    }
+
 } // namespace OpenRCT2::Profiling
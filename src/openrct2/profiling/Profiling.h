@@ -10,12 +10,11 @@
 
 #include "ProfilingMacros.hpp"
 
-#include <array>
 #include <atomic>
 #include <cstdint>
-#include <mutex>
+#include <iosfwd>
 #include <string>
-#include <unordered_set>
+#include <string_view>
 #include <vector>
 
 namespace OpenRCT2::Profiling
@@ -56,85 +55,32 @@ namespace OpenRCT2::Profiling
     namespace Detail
     {
         static constexpr auto MaxSamplesSize = 1024;
-        static constexpr auto MaxNameSize = 250;
 
         std::vector<Function*>& GetRegistry();
 
+        /**
+         * The statistics live with the threads that made the calls, see Profiling.cpp, and are merged when read.
+         */
         struct FunctionInternal : Function
         {
             FunctionInternal()
+                : Index(static_cast<uint32_t>(GetRegistry().size()))
             {
                 GetRegistry().push_back(this);
             }
 
             virtual ~FunctionInternal() = default;
 
-            // Functions marked MT require locking, this is per function basis.
-            mutable std::mutex Mutex;
+            // Position in the registry, used to index the statistics of each thread.
+            const uint32_t Index;
 
-            std::array<char, MaxNameSize> Name{};
-
-            // Call count of function.
-            std::atomic<uint64_t> CallCount{};
-
-            // Function times in microseconds.
-            std::array<double, MaxSamplesSize> Samples{};
-
-            // Used internally to write into Samples without a lock.
-            std::atomic<size_t> SampleIterator{};
-
-            double MinTimeUs{};
-
-            double MaxTimeUs{};
-
-            double TotalTimeUs{};
-
-            // Functions that called us.
-            std::unordered_set<Function*> Parents;
-
-            // Functions that this function called.
-            std::unordered_set<Function*> Children;
-
-            uint64_t GetCallCount() const noexcept override
-            {
-                return CallCount.load();
-            }
-
-            std::vector<double> GetTimeSamples() const override
-            {
-                const auto numSamples = std::min(SampleIterator.load(), Samples.size());
-                return { Samples.begin(), Samples.begin() + numSamples };
-            }
-
-            std::vector<Function*> GetParents() const override
-            {
-                std::scoped_lock lock(Mutex);
-                return { Parents.begin(), Parents.end() };
-            }
-
-            std::vector<Function*> GetChildren() const override
-            {
-                std::scoped_lock lock(Mutex);
-                return { Children.begin(), Children.end() };
-            }
-
-            double GetTotalTime() const override
-            {
-                std::scoped_lock lock(Mutex);
-                return TotalTimeUs;
-            }
-
-            double GetMinTime() const override
-            {
-                std::scoped_lock lock(Mutex);
-                return MinTimeUs;
-            }
-
-            double GetMaxTime() const override
-            {
-                std::scoped_lock lock(Mutex);
-                return MaxTimeUs;
-            }
+            uint64_t GetCallCount() const noexcept override;
+            std::vector<double> GetTimeSamples() const override;
+            double GetTotalTime() const override;
+            double GetMinTime() const override;
+            double GetMaxTime() const override;
+            std::vector<Function*> GetParents() const override;
+            std::vector<Function*> GetChildren() const override;
         };
 
         template<typename TName> struct FunctionWrapper : FunctionInternal
@@ -190,4 +136,17 @@ namespace OpenRCT2::Profiling
 
     bool ExportCSV(const std::string& filePath);
 
+    // Starts recording a timeline event for every profiled call made while the profiler is enabled,
+    // discarding the events of the previous trace.
+    void StartTrace();
+    void StopTrace();
+    bool IsTracing();
+
+    // Names the calling thread in traces recorded after this call.
+    void SetThreadName(std::string_view name);
+
+    // Writes the recorded events as Chrome trace event JSON, which chrome://tracing and Perfetto can open.
+    void WriteTrace(std::ostream& out);
+    bool ExportTrace(const std::string& filePath);
+
 } // namespace OpenRCT2::Profiling
@@ -0,0 +1,295 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2022 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TickStats.h"
+
+#include "../Diagnostic.h"
+#include "../Game.h"
+#include "../core/File.h"
+#include "../core/Path.hpp"
+#include "../entity/EntityList.h"
+#include "../world/Map.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <ostream>
+
+namespace OpenRCT2::TickStats
+{
+    static constexpr size_t NumParts = static_cast<size_t>(LogicTimePart::Count);
+
+    static constexpr std::string_view PartNames[] = {
+        "NetworkUpdate",
+        "Date",
+        "Scenario",
+        "Climate",
+        "MapTiles",
+        "MapStashProvisionalElements",
+        "MapPathWideFlags",
+        "Peep",
+        "MapRestoreProvisionalElements",
+        "Vehicle",
+        "Misc",
+        "Ride",
+        "Park",
+        "Research",
+        "RideRatings",
+        "RideMeasurements",
+        "News",
+        "MapAnimation",
+        "Sounds",
+        "GameActions",
+        "NetworkFlush",
+        "Scripts",
+    };
+    static_assert(std::size(PartNames) == NumParts);
+
+    static constexpr std::string_view TotalName = "Total";
+
+    // Named like the entity types of the plugin API.
+    static constexpr std::string_view EntityNames[] = {
+        "car",
+        "guest",
+        "staff",
+        "litter",
+        "steam_particle",
+        "money_effect",
+        "crashed_vehicle_particle",
+        "explosion_cloud",
+        "crash_splash",
+        "explosion_flare",
+        "jumping_fountain",
+        "balloon",
+        "duck",
+    };
+    static_assert(std::size(EntityNames) == static_cast<size_t>(EntityType::Count));
+
+    // Values below 16ns get a bucket each, after that every power of two is split into 8 buckets.
+    static constexpr size_t NumBuckets = 16 + 28 * 8;
+
+    static size_t GetBucket(uint32_t ns)
+    {
+        if (ns < 16)
+            return ns;
+
+        uint32_t shift = 1;
+        while ((ns >> shift) >= 16)
+            shift++;
+        return 16 + (shift - 1) * 8 + ((ns >> shift) - 8);
+    }
+
+    static uint32_t GetBucketUpperBound(size_t bucket)
+    {
+        if (bucket < 16)
+            return static_cast<uint32_t>(bucket);
+
+        const auto shift = static_cast<uint32_t>((bucket - 16) / 8 + 1);
+        const auto mantissa = static_cast<uint64_t>((bucket - 16) % 8 + 8);
+        return static_cast<uint32_t>(((mantissa + 1) << shift) - 1);
+    }
+
+    /**
+     * The times of one part over the window, kept both as a ring of samples and as a histogram of them so that
+     * adding a sample only has to move one count out of and one into the histogram.
+     */
+    struct Series
+    {
+        std::array<uint32_t, WindowSize> SamplesNs{};
+        std::array<uint16_t, NumBuckets> BucketCounts{};
+
+        void Add(size_t slot, bool replace, std::chrono::nanoseconds time)
+        {
+            if (replace)
+            {
+                BucketCounts[GetBucket(SamplesNs[slot])]--;
+            }
+
+            const auto ns = static_cast<uint32_t>(
+                std::clamp<int64_t>(time.count(), 0, std::numeric_limits<uint32_t>::max()));
+            SamplesNs[slot] = ns;
+            BucketCounts[GetBucket(ns)]++;
+        }
+
+        PartStats GetStats(std::string_view name, size_t numSamples) const
+        {
+            PartStats stats;
+            stats.Name = name;
+            if (numSamples == 0)
+                return stats;
+
+            const auto maxNs = *std::max_element(SamplesNs.begin(), SamplesNs.begin() + numSamples);
+            const auto getPercentile = [&](double percentile) {
+                const auto rank = std::max<size_t>(1, static_cast<size_t>(std::ceil(percentile * numSamples)));
+                size_t count = 0;
+                for (size_t i = 0; i < NumBuckets; i++)
+                {
+                    count += BucketCounts[i];
+                    if (count >= rank)
+                    {
+                        return std::min(GetBucketUpperBound(i), maxNs) / 1000000.0;
+                    }
+                }
+                return maxNs / 1000000.0;
+            };
+
+            stats.P50 = getPercentile(0.50);
+            stats.P95 = getPercentile(0.95);
+            stats.P99 = getPercentile(0.99);
+            stats.Max = maxNs / 1000000.0;
+            return stats;
+        }
+    };
+
+    // Only accessed from the game thread.
+    static std::array<Series, NumParts + 1> _series;
+    static size_t _numTicks;
+    static u8string _dumpPath;
+    static uint32_t _dumpInterval = WindowSize;
+    static uint32_t _ticksSinceDump;
+
+    void RecordTick(const TickTimes& partTimes, std::chrono::nanoseconds tickTime)
+    {
+        const auto slot = _numTicks % WindowSize;
+        const auto replace = _numTicks >= WindowSize;
+        for (size_t i = 0; i < NumParts; i++)
+        {
+            _series[i].Add(slot, replace, partTimes[i]);
+        }
+        _series[NumParts].Add(slot, replace, tickTime);
+        _numTicks++;
+
+        if (!_dumpPath.empty() && ++_ticksSinceDump >= _dumpInterval)
+        {
+            _ticksSinceDump = 0;
+            if (!AppendToFile(_dumpPath))
+            {
+                log_warning("Unable to write tick stats to %s", _dumpPath.c_str());
+            }
+        }
+    }
+
+    void Reset()
+    {
+        _series = {};
+        _numTicks = 0;
+        _ticksSinceDump = 0;
+    }
+
+    Summary GetSummary()
+    {
+        Summary summary;
+        summary.CurrentTick = gCurrentTicks;
+        summary.NumTicks = std::min(_numTicks, WindowSize);
+        for (size_t i = 0; i < NumParts; i++)
+        {
+            summary.Parts.push_back(_series[i].GetStats(PartNames[i], summary.NumTicks));
+        }
+        summary.Parts.push_back(_series[NumParts].GetStats(TotalName, summary.NumTicks));
+        for (size_t i = 0; i < std::size(EntityNames); i++)
+        {
+            summary.EntityCounts.emplace_back(EntityNames[i], GetEntityListCount(static_cast<EntityType>(i)));
+        }
+        summary.TileElementCount = GetTileElementsInUse();
+        return summary;
+    }
+
+    void WriteJson(std::ostream& out, const Summary& summary)
+    {
+        out << std::fixed << std::setprecision(4);
+        out << R"({"tick":)" << summary.CurrentTick << R"(,"numTicks":)" << summary.NumTicks << R"(,"parts":{)";
+        for (size_t i = 0; i < summary.Parts.size(); i++)
+        {
+            const auto& part = summary.Parts[i];
+            out << (i == 0 ? "" : ",") << '"' << part.Name << R"(":{"p50":)" << part.P50 << R"(,"p95":)" << part.P95
+                << R"(,"p99":)" << part.P99 << R"(,"max":)" << part.Max << '}';
+        }
+        out << R"(},"entities":{)";
+        for (size_t i = 0; i < summary.EntityCounts.size(); i++)
+        {
+            const auto& [name, count] = summary.EntityCounts[i];
+            out << (i == 0 ? "" : ",") << '"' << name << R"(":)" << count;
+        }
+        out << R"(},"tileElements":)" << summary.TileElementCount << "}\n";
+    }
+
+    void WriteCsvHeader(std::ostream& out, const Summary& summary)
+    {
+        out << "tick,numTicks";
+        for (const auto& part : summary.Parts)
+        {
+            out << ',' << part.Name << "P50," << part.Name << "P95," << part.Name << "P99," << part.Name << "Max";
+        }
+        for (const auto& [name, count] : summary.EntityCounts)
+        {
+            out << ',' << name;
+        }
+        out << ",tileElements\n";
+    }
+
+    void WriteCsvRow(std::ostream& out, const Summary& summary)
+    {
+        out << std::fixed << std::setprecision(4);
+        out << summary.CurrentTick << ',' << summary.NumTicks;
+        for (const auto& part : summary.Parts)
+        {
+            out << ',' << part.P50 << ',' << part.P95 << ',' << part.P99 << ',' << part.Max;
+        }
+        for (const auto& [name, count] : summary.EntityCounts)
+        {
+            out << ',' << count;
+        }
+        out << ',' << summary.TileElementCount << '\n';
+    }
+
+    bool AppendToFile(const u8string& path)
+    {
+        const auto isCsv = String::Equals(Path::GetExtension(path), ".csv", true);
+        const auto isNewFile = !File::Exists(path);
+
+        // Opened for every write so that the file can be moved away while the game runs.
+        std::ofstream out(path, std::ios::app);
+        if (!out.is_open())
+            return false;
+
+        const auto summary = GetSummary();
+        if (isCsv)
+        {
+            if (isNewFile)
+            {
+                WriteCsvHeader(out, summary);
+            }
+            WriteCsvRow(out, summary);
+        }
+        else
+        {
+            WriteJson(out, summary);
+        }
+        return out.good();
+    }
+
+    void SetDumpFile(const u8string& path, uint32_t intervalTicks)
+    {
+        _dumpPath = path;
+        _dumpInterval = std::max<uint32_t>(1, intervalTicks);
+        _ticksSinceDump = 0;
+    }
+
+    const u8string& GetDumpFile()
+    {
+        return _dumpPath;
+    }
+
+    uint32_t GetDumpInterval()
+    {
+        return _dumpInterval;
+    }
+} // namespace OpenRCT2::TickStats
@@ -0,0 +1,76 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2022 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../GameState.h"
+#include "../core/String.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/**
+ * Keeps how long each part of the most recent game ticks took, along with the entity and tile element counts, so
+ * that a running server can be inspected. Recording a tick costs a few array updates, so it is always on.
+ */
+namespace OpenRCT2::TickStats
+{
+    // The number of most recent ticks the percentiles are taken over, ~25s at 40Hz.
+    constexpr size_t WindowSize = 1024;
+
+    using TickTimes = std::array<std::chrono::nanoseconds, static_cast<size_t>(LogicTimePart::Count)>;
+
+    struct PartStats
+    {
+        std::string_view Name;
+
+        // Times in milliseconds, the percentiles are rounded up by at most 12.5%.
+        double P50{};
+        double P95{};
+        double P99{};
+        double Max{};
+    };
+
+    struct Summary
+    {
+        uint32_t CurrentTick{};
+
+        // The number of ticks the times are taken over, at most WindowSize.
+        size_t NumTicks{};
+
+        // One for each LogicTimePart, followed by the whole tick.
+        std::vector<PartStats> Parts;
+
+        std::vector<std::pair<std::string_view, uint16_t>> EntityCounts;
+        size_t TileElementCount{};
+    };
+
+    // Records how long each part of a tick took, see GameState::UpdateLogic.
+    void RecordTick(const TickTimes& partTimes, std::chrono::nanoseconds tickTime);
+    void Reset();
+    Summary GetSummary();
+
+    // Writes the summary as a single line JSON object.
+    void WriteJson(std::ostream& out, const Summary& summary);
+    void WriteCsvHeader(std::ostream& out, const Summary& summary);
+    void WriteCsvRow(std::ostream& out, const Summary& summary);
+
+    // Appends the current summary to the file, as CSV when its extension is .csv or else as JSON lines.
+    bool AppendToFile(const u8string& path);
+
+    // Appends the summary to the file every given number of ticks, an empty path stops the dump.
+    void SetDumpFile(const u8string& path, uint32_t intervalTicks = WindowSize);
+    const u8string& GetDumpFile();
+    uint32_t GetDumpInterval();
+} // namespace OpenRCT2::TickStats
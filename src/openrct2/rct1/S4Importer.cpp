@@ -1504,6 +1504,7 @@ namespace RCT1
         void ImportTileElements()
         {
             gMapBaseZ = 7;
+            gWidePathUseDirtyTiles = false;
 
             // Build tile pointer cache (needed to get the first element at a certain location)
             auto tilePointerIndex = TilePointerIndex<RCT12TileElement>(
@@ -478,6 +478,7 @@ namespace RCT2
             // rct1_scenario_flags
             gWidePathTileLoopPosition.x = _s6.wide_path_tile_loop_x;
             gWidePathTileLoopPosition.y = _s6.wide_path_tile_loop_y;
+            gWidePathUseDirtyTiles = false;
             // pad_13CE778
 
             // Fix and set dynamic variables
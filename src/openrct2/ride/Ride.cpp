@@ -26,6 +26,7 @@
 #include "../core/Guard.hpp"
 #include "../core/Numerics.hpp"
 #include "../entity/EntityRegistry.h"
+#include "../entity/GuestHotFields.h"
 #include "../entity/Peep.h"
 #include "../entity/Staff.h"
 #include "../interface/Window.h"
@@ -326,16 +327,16 @@ void Ride::QueueInsertGuestAtFront(StationIndex stationIndex, Guest* peep)
  *
  *  rct2: 0x006AC916
  */
-void ride_update_favourited_stat()
+void ride_update_favourited_stat(const GuestHotFields& guests)
 {
     for (auto& ride : GetRideManager())
         ride.guests_favourite = 0;
 
-    for (auto peep : EntityList<Guest>())
+    for (auto favouriteRide : guests.FavouriteRide)
     {
-        if (!peep->FavouriteRide.IsNull())
+        if (!favouriteRide.IsNull())
         {
-            auto ride = get_ride(peep->FavouriteRide);
+            auto ride = get_ride(favouriteRide);
             if (ride != nullptr)
             {
                 ride->guests_favourite++;
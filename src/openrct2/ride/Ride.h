@@ -30,6 +30,7 @@ class StationObject;
 struct Ride;
 struct RideTypeDescriptor;
 struct Guest;
+struct GuestHotFields;
 struct Staff;
 struct Vehicle;
 struct rct_ride_entry;
@@ -978,7 +979,7 @@ extern ObjectEntryIndex gLastEntranceStyle;
 int32_t ride_get_count();
 void ride_init_all();
 void reset_all_ride_build_dates();
-void ride_update_favourited_stat();
+void ride_update_favourited_stat(const GuestHotFields& guests);
 void ride_check_all_reachable();
 
 bool ride_try_get_origin_element(const Ride* ride, CoordsXYE* output);
@@ -677,6 +677,28 @@ uint16_t Vehicle::GetTrackProgress() const
     return vehicle_get_move_info_size(TrackSubposition, GetTrackType(), GetTrackDirection());
 }
 
+TileElement* Vehicle::FindTrackElement(track_type_t trackType) const
+{
+    const auto generation = MapGetTileElementsGeneration();
+    if (CachedTrackElement != nullptr && CachedTrackElementsGeneration == generation && CachedTrackLocation == TrackLocation
+        && CachedTrackType == trackType)
+    {
+        // Elements can still be edited in place, such as station pieces changing type, so check it would still be found.
+        const auto* trackElement = CachedTrackElement->AsTrack();
+        if (trackElement != nullptr && trackElement->GetBaseZ() == TrackLocation.z
+            && trackElement->GetTrackType() == trackType && trackElement->GetSequenceIndex() == 0)
+        {
+            return CachedTrackElement;
+        }
+    }
+
+    CachedTrackElement = map_get_track_element_at_of_type_seq(TrackLocation, trackType, 0);
+    CachedTrackLocation = TrackLocation;
+    CachedTrackType = trackType;
+    CachedTrackElementsGeneration = generation;
+    return CachedTrackElement;
+}
+
 void Vehicle::ApplyMass(int16_t appliedMass)
 {
     mass = std::clamp<int32_t>(mass + appliedMass, 1, std::numeric_limits<decltype(mass)>::max());
@@ -7082,7 +7104,7 @@ void Vehicle::UpdateAnimationAnimalFlying()
     if (animation_frame == 0)
     {
         auto trackType = GetTrackType();
-        TileElement* trackElement = map_get_track_element_at_of_type_seq(TrackLocation, trackType, 0);
+        TileElement* trackElement = FindTrackElement(trackType);
         if (trackElement != nullptr && trackElement->AsTrack()->HasChain())
         {
             // start flapping, bird
@@ -7779,7 +7801,7 @@ void Vehicle::Sub6DBF3E()
     TileElement* tileElement = nullptr;
     if (map_is_location_valid(TrackLocation))
     {
-        tileElement = map_get_track_element_at_of_type_seq(TrackLocation, trackType, 0);
+        tileElement = FindTrackElement(trackType);
     }
 
     if (tileElement == nullptr)
@@ -7856,7 +7878,7 @@ bool Vehicle::UpdateTrackMotionForwardsGetNewTrack(uint16_t trackType, Ride* cur
     CoordsXYZD location = {};
 
     auto pitchAndRollEnd = TrackPitchAndRollEnd(trackType);
-    TileElement* tileElement = map_get_track_element_at_of_type_seq(TrackLocation, trackType, 0);
+    TileElement* tileElement = FindTrackElement(trackType);
 
     if (tileElement == nullptr)
     {
@@ -8274,7 +8296,7 @@ static PitchAndRoll PitchAndRollEnd(Ride* curRide, bool useInvertedSprites, uint
 bool Vehicle::UpdateTrackMotionBackwardsGetNewTrack(uint16_t trackType, Ride* curRide, uint16_t* progress)
 {
     auto pitchAndRollStart = TrackPitchAndRollStart(trackType);
-    TileElement* tileElement = map_get_track_element_at_of_type_seq(TrackLocation, trackType, 0);
+    TileElement* tileElement = FindTrackElement(trackType);
 
     if (tileElement == nullptr)
         return false;
@@ -8692,7 +8714,7 @@ loc_6DC476:
         }
     }
 
-    tileElement = map_get_track_element_at_of_type_seq(TrackLocation, GetTrackType(), 0);
+    tileElement = FindTrackElement(GetTrackType());
     {
         CoordsXYE output;
         int32_t outZ{};
@@ -8909,7 +8931,7 @@ loc_6DCA9A:
         goto loc_6DCC2C;
     }
 
-    tileElement = map_get_track_element_at_of_type_seq(TrackLocation, GetTrackType(), 0);
+    tileElement = FindTrackElement(GetTrackType());
     {
         track_begin_end trackBeginEnd;
         if (!track_block_get_previous({ TrackLocation, tileElement }, &trackBeginEnd))
@@ -9637,9 +9659,7 @@ void Vehicle::UpdateCrossings() const
     track_begin_end output{};
     int32_t direction{};
 
-    CoordsXYE xyElement = { frontVehicle->TrackLocation,
-                            map_get_track_element_at_of_type_seq(
-                                frontVehicle->TrackLocation, frontVehicle->GetTrackType(), 0) };
+    CoordsXYE xyElement = { frontVehicle->TrackLocation, frontVehicle->FindTrackElement(frontVehicle->GetTrackType()) };
     int32_t curZ = frontVehicle->TrackLocation.z;
 
     if (xyElement.element != nullptr && status != Vehicle::Status::Arriving)
@@ -9709,8 +9729,7 @@ void Vehicle::UpdateCrossings() const
         }
     }
 
-    xyElement = { backVehicle->TrackLocation,
-                  map_get_track_element_at_of_type_seq(backVehicle->TrackLocation, backVehicle->GetTrackType(), 0) };
+    xyElement = { backVehicle->TrackLocation, backVehicle->FindTrackElement(backVehicle->GetTrackType()) };
     curZ = backVehicle->TrackLocation.z;
 
     if (xyElement.element != nullptr)
@@ -31,6 +31,7 @@ struct rct_ride_entry;
 struct rct_ride_entry_vehicle;
 class DataSerialiser;
 struct paint_session;
+struct TileElement;
 
 struct GForces
 {
@@ -209,6 +210,13 @@ struct Vehicle : EntityBase
     CoordsXY BoatLocation;
     bool IsCrashedVehicle;
 
+    // The element last found by FindTrackElement, it is only reused for the same lookup while the tile elements
+    // generation is unchanged. Not part of the game state.
+    mutable TileElement* CachedTrackElement;
+    mutable CoordsXYZ CachedTrackLocation;
+    mutable track_type_t CachedTrackType;
+    mutable uint32_t CachedTrackElementsGeneration;
+
     constexpr bool IsHead() const
     {
         return SubType == Vehicle::Type::Head;
@@ -244,6 +252,11 @@ struct Vehicle : EntityBase
     {
         return TrackTypeAndDirection & VehicleTrackDirectionMask;
     }
+    /**
+     * Same as map_get_track_element_at_of_type_seq(TrackLocation, trackType, 0), but only searches the tile again once
+     * the vehicle has moved on or the tile elements have changed.
+     */
+    TileElement* FindTrackElement(track_type_t trackType) const;
     void SetTrackType(track_type_t trackType)
     {
         // set the upper 14 bits to 0, then set track type
@@ -25,6 +25,7 @@
 #include "../core/Random.hpp"
 #include "../entity/Duck.h"
 #include "../entity/Guest.h"
+#include "../entity/GuestHotFields.h"
 #include "../entity/Staff.h"
 #include "../interface/Viewport.h"
 #include "../localisation/Date.h"
@@ -92,6 +93,9 @@ void scenario_begin()
 {
     game_load_init();
 
+    // Scenarios saved by older versions still use the rolling path wide flag sweep, new games track dirty tiles.
+    map_enable_path_wide_dirty_tiles();
+
     // Set the scenario pseudo-random seeds
     Random::Rct2::Seed s{ 0x1234567F ^ Platform::GetTicks(), 0x789FABCD ^ Platform::GetTicks() };
     gScenarioRand.seed(s);
@@ -106,7 +110,7 @@ void scenario_begin()
         context_open_window_view(WV_PARK_OBJECTIVE);
 
     auto& park = GetContext()->GetGameState()->GetPark();
-    gParkRating = park.CalculateParkRating();
+    gParkRating = park.CalculateParkRating(GuestHotFields::GatherShared());
     gParkValue = park.CalculateParkValue();
     gCompanyValue = park.CalculateCompanyValue();
     gHistoricalProfit = gInitialCash - gBankLoan;
@@ -318,7 +322,7 @@ static void scenario_day_update()
     context_broadcast_intent(&intent);
 }
 
-static void scenario_week_update()
+static void scenario_week_update(const GuestHotFields& guests)
 {
     int32_t month = date_get_month(gDateMonthsElapsed);
 
@@ -326,9 +330,9 @@ static void scenario_week_update()
     finance_pay_research();
     finance_pay_interest();
     marketing_update();
-    peep_problem_warnings_update();
+    peep_problem_warnings_update(guests);
     ride_check_all_reachable();
-    ride_update_favourited_stat();
+    ride_update_favourited_stat(guests);
 
     auto water_type = static_cast<rct_water_type*>(object_entry_get_chunk(ObjectType::Water, 0));
 
@@ -348,12 +352,12 @@ static void scenario_fortnight_update()
     finance_pay_ride_upkeep();
 }
 
-static void scenario_month_update()
+static void scenario_month_update(const GuestHotFields& guests)
 {
     finance_shift_expenditure_table();
     scenario_objective_check();
     scenario_entrance_fee_too_high_check();
-    award_update_all();
+    award_update_all(guests);
 }
 
 static void scenario_update_daynight_cycle()
@@ -407,17 +411,23 @@ void scenario_update()
         {
             scenario_day_update();
         }
-        if (date_is_week_start(gDateMonthTicks))
+
+        // The weekly guest warnings and the monthly awards read one copy of the guest fields, gathered after the
+        // daily update like the passes used to read the guests.
+        const auto isWeekStart = date_is_week_start(gDateMonthTicks);
+        const auto isMonthStart = date_is_month_start(gDateMonthTicks);
+        const GuestHotFields* guests = isWeekStart || isMonthStart ? &GuestHotFields::GatherShared() : nullptr;
+        if (isWeekStart)
         {
-            scenario_week_update();
+            scenario_week_update(*guests);
         }
         if (date_is_fortnight_start(gDateMonthTicks))
         {
             scenario_fortnight_update();
         }
-        if (date_is_month_start(gDateMonthTicks))
+        if (isMonthStart)
         {
-            scenario_month_update();
+            scenario_month_update(*guests);
         }
     }
     scenario_update_daynight_cycle();
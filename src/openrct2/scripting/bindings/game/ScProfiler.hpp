@@ -12,8 +12,12 @@
 #ifdef ENABLE_SCRIPTING
 
 #    include "../../../profiling/Profiling.h"
+#    include "../../../profiling/TickStats.h"
 #    include "../../Duktape.hpp"
 
+#    include <sstream>
+#    include <string>
+
 namespace OpenRCT2::Scripting
 {
     class ScProfiler
@@ -77,6 +81,20 @@ namespace OpenRCT2::Scripting
         void stop()
         {
             OpenRCT2::Profiling::Disable();
+            OpenRCT2::Profiling::StopTrace();
+        }
+
+        void startTrace()
+        {
+            OpenRCT2::Profiling::Enable();
+            OpenRCT2::Profiling::StartTrace();
+        }
+
+        std::string getTrace()
+        {
+            std::ostringstream out;
+            OpenRCT2::Profiling::WriteTrace(out);
+            return out.str();
         }
 
         void reset()
@@ -84,11 +102,56 @@ namespace OpenRCT2::Scripting
             OpenRCT2::Profiling::ResetData();
         }
 
+        DukValue getTickStats()
+        {
+            const auto summary = OpenRCT2::TickStats::GetSummary();
+
+            duk_push_array(_ctx);
+            duk_uarridx_t index = 0;
+            for (const auto& part : summary.Parts)
+            {
+                DukObject obj(_ctx);
+                obj.Set("name", part.Name);
+                obj.Set("p50", part.P50);
+                obj.Set("p95", part.P95);
+                obj.Set("p99", part.P99);
+                obj.Set("max", part.Max);
+                obj.Take().push();
+                duk_put_prop_index(_ctx, /* duk stack index */ -2, index);
+                index++;
+            }
+            auto parts = DukValue::take_from_stack(_ctx);
+
+            DukObject entities(_ctx);
+            for (const auto& [name, count] : summary.EntityCounts)
+            {
+                entities.Set(std::string(name).c_str(), static_cast<int32_t>(count));
+            }
+
+            DukObject result(_ctx);
+            result.Set("tick", summary.CurrentTick);
+            result.Set("tickCount", static_cast<uint32_t>(summary.NumTicks));
+            result.Set("parts", parts);
+            result.Set("entities", entities.Take());
+            result.Set("tileElements", static_cast<uint32_t>(summary.TileElementCount));
+            return result.Take();
+        }
+
+        void resetTickStats()
+        {
+            OpenRCT2::TickStats::Reset();
+        }
+
         bool enabled_get() const
         {
             return OpenRCT2::Profiling::IsEnabled();
         }
 
+        bool tracing_get() const
+        {
+            return OpenRCT2::Profiling::IsTracing();
+        }
+
     public:
         static void Register(duk_context* ctx)
         {
@@ -96,7 +159,12 @@ namespace OpenRCT2::Scripting
             dukglue_register_method(ctx, &ScProfiler::start, "start");
             dukglue_register_method(ctx, &ScProfiler::stop, "stop");
             dukglue_register_method(ctx, &ScProfiler::reset, "reset");
+            dukglue_register_method(ctx, &ScProfiler::startTrace, "startTrace");
+            dukglue_register_method(ctx, &ScProfiler::getTrace, "getTrace");
+            dukglue_register_method(ctx, &ScProfiler::getTickStats, "getTickStats");
+            dukglue_register_method(ctx, &ScProfiler::resetTickStats, "resetTickStats");
             dukglue_register_property(ctx, &ScProfiler::enabled_get, nullptr, "enabled");
+            dukglue_register_property(ctx, &ScProfiler::tracing_get, nullptr, "tracing");
         }
     };
 } // namespace OpenRCT2::Scripting
@@ -151,6 +151,8 @@ namespace OpenRCT2::Scripting
             }
             obj.Set("bytesSent", DukValue::take_from_stack(_context));
         }
+        obj.Set("bytesCopied", networkStats.bytesCopied);
+        obj.Set("sendCalls", networkStats.sendCalls);
         return obj.Take();
 #    else
         return ToDuk(_context, nullptr);
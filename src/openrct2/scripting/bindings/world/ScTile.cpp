@@ -125,6 +125,8 @@ namespace OpenRCT2::Scripting
                     first[numElements - 1].SetLastForTile(true);
                 }
             }
+            map_invalidate_path_wide_flags(_coords, 1);
+            MapInvalidateTileElementPointers();
             map_invalidate_tile_full(_coords);
         }
     }
@@ -196,6 +198,7 @@ namespace OpenRCT2::Scripting
         if (index < GetNumElements(first))
         {
             tile_element_remove(&first[index]);
+            map_invalidate_path_wide_flags(_coords, 1);
             map_invalidate_tile_full(_coords);
         }
     }
@@ -18,6 +18,7 @@
 #    include "../../../ride/Ride.h"
 #    include "../../../ride/Track.h"
 #    include "../../../world/Footpath.h"
+#    include "../../../world/RidePresence.h"
 #    include "../../../world/Scenery.h"
 #    include "../../../world/Surface.h"
 #    include "../../Duktape.hpp"
@@ -84,6 +85,7 @@ namespace OpenRCT2::Scripting
             return;
         }
 
+        RidePresenceInvalidateTile(_coords);
         Invalidate();
     }
 
@@ -501,6 +503,7 @@ namespace OpenRCT2::Scripting
                 {
                     auto el = _element->AsTrack();
                     el->SetRideIndex(RideId::FromUnderlying(value.as_uint()));
+                    RidePresenceInvalidateTile(_coords);
                     Invalidate();
                 }
                 break;
@@ -1626,6 +1629,8 @@ namespace OpenRCT2::Scripting
 
     void ScTileElement::Invalidate()
     {
+        map_invalidate_path_wide_flags(_coords, 1);
+        MapInvalidateTileElementPointers();
         map_invalidate_tile_full(_coords);
     }
 
@@ -506,7 +506,7 @@ bool util_gzip_compress(FILE* source, FILE* dest)
     return true;
 }
 
-std::vector<uint8_t> Gzip(const void* data, const size_t dataLen)
+std::vector<uint8_t> Gzip(const void* data, const size_t dataLen, int32_t level)
 {
     assert(data != nullptr);
 
@@ -517,7 +517,7 @@ std::vector<uint8_t> Gzip(const void* data, const size_t dataLen)
     strm.opaque = Z_NULL;
 
     {
-        const auto ret = deflateInit2(&strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 | 16, 8, Z_DEFAULT_STRATEGY);
+        const auto ret = deflateInit2(&strm, level, Z_DEFLATED, 15 | 16, 8, Z_DEFAULT_STRATEGY);
         if (ret != Z_OK)
         {
             throw std::runtime_error("deflateInit2 failed with error " + std::to_string(ret));
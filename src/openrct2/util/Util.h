@@ -48,7 +48,7 @@ bool str_is_null_or_empty(const char* str);
 uint32_t util_rand();
 
 bool util_gzip_compress(FILE* source, FILE* dest);
-std::vector<uint8_t> Gzip(const void* data, const size_t dataLen);
+std::vector<uint8_t> Gzip(const void* data, const size_t dataLen, int32_t level = -1);
 std::vector<uint8_t> Ungzip(const void* data, const size_t dataLen);
 
 int8_t add_clamp_int8_t(int8_t value, int8_t value_to_add);
@@ -1025,6 +1025,8 @@ void footpath_connect_edges(const CoordsXY& footpathPos, TileElement* tileElemen
     rct_neighbour_list neighbourList;
     rct_neighbour neighbour;
 
+    // The edges of the neighbouring paths are changed as well.
+    map_invalidate_path_wide_flags(footpathPos, 2);
     footpath_update_queue_chains();
 
     neighbour_list_init(&neighbourList);
@@ -2292,6 +2294,7 @@ static void footpath_fix_corners_around(const TileCoordsXY& footpathPos, TileEle
  */
 void footpath_remove_edges_at(const CoordsXY& footpathPos, TileElement* tileElement)
 {
+    map_invalidate_path_wide_flags(footpathPos, 2);
     if (tileElement->GetType() == TileElementType::Track)
     {
         auto rideIndex = tileElement->AsTrack()->GetRideIndex();
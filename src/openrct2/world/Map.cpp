@@ -29,6 +29,7 @@
 #include "../network/network.h"
 #include "../object/ObjectManager.h"
 #include "../object/TerrainSurfaceObject.h"
+#include "../paint/PaintCache.h"
 #include "../profiling/Profiling.h"
 #include "../ride/RideConstruction.h"
 #include "../ride/RideData.h"
@@ -45,6 +46,7 @@
 #include "LargeScenery.h"
 #include "MapAnimation.h"
 #include "Park.h"
+#include "RidePresence.h"
 #include "Scenery.h"
 #include "SmallScenery.h"
 #include "Surface.h"
@@ -55,6 +57,7 @@
 #include <algorithm>
 #include <iterator>
 #include <memory>
+#include <set>
 
 using namespace OpenRCT2;
 
@@ -88,6 +91,7 @@ CoordsXYZ gMapSelectArrowPosition;
 uint8_t gMapSelectArrowDirection;
 
 TileCoordsXY gWidePathTileLoopPosition;
+bool gWidePathUseDirtyTiles;
 uint16_t gGrassSceneryTileLoopPosition;
 
 TileCoordsXY gMapSize;
@@ -115,6 +119,11 @@ static size_t _tileElementsInUse;
 static size_t _tileElementsInUseStash;
 static TileCoordsXY _mapSizeStash;
 static int32_t _currentRotationStash;
+static uint32_t _tileElementsGeneration = 1;
+
+// Tiles waiting for their path wide flags to be recomputed, keyed so that they are ordered like the sweep (by y then x).
+static std::set<uint32_t> _widePathDirtyTiles;
+static std::set<uint32_t> _widePathDirtyTilesStash;
 
 void StashMap()
 {
@@ -123,6 +132,9 @@ void StashMap()
     _mapSizeStash = gMapSize;
     _currentRotationStash = gCurrentRotation;
     _tileElementsInUseStash = _tileElementsInUse;
+    _widePathDirtyTilesStash = std::move(_widePathDirtyTiles);
+    _widePathDirtyTiles.clear();
+    MapInvalidateTileElementPointers();
 }
 
 void UnstashMap()
@@ -132,6 +144,10 @@ void UnstashMap()
     gMapSize = _mapSizeStash;
     gCurrentRotation = _currentRotationStash;
     _tileElementsInUse = _tileElementsInUseStash;
+    _widePathDirtyTiles = std::move(_widePathDirtyTilesStash);
+    _widePathDirtyTilesStash.clear();
+    RidePresenceInvalidateAll();
+    MapInvalidateTileElementPointers();
 }
 
 const std::vector<TileElement>& GetTileElements()
@@ -139,11 +155,32 @@ const std::vector<TileElement>& GetTileElements()
     return _tileElements;
 }
 
+size_t GetTileElementsInUse()
+{
+    return _tileElementsInUse;
+}
+
 void SetTileElements(std::vector<TileElement>&& tileElements)
 {
     _tileElements = std::move(tileElements);
     _tileIndex = TilePointerIndex<TileElement>(MAXIMUM_MAP_SIZE_TECHNICAL, _tileElements.data(), _tileElements.size());
     _tileElementsInUse = _tileElements.size();
+    RidePresenceInvalidateAll();
+    MapInvalidateTileElementPointers();
+}
+
+uint32_t MapGetTileElementsGeneration()
+{
+    return _tileElementsGeneration;
+}
+
+void MapInvalidateTileElementPointers()
+{
+    // Zero is what a reset cache holds, skip it so such a cache never matches.
+    if (++_tileElementsGeneration == 0)
+    {
+        _tileElementsGeneration = 1;
+    }
 }
 
 static TileElement GetDefaultSurfaceElement()
@@ -379,6 +416,7 @@ void map_set_tile_element(const TileCoordsXY& tilePos, TileElement* elements)
         return;
     }
     _tileIndex.SetTile(tilePos, elements);
+    MapInvalidateTileElementPointers();
 }
 
 SurfaceElement* map_get_surface_element_at(const CoordsXY& coords)
@@ -441,9 +479,12 @@ void map_init(const TileCoordsXY& size)
         element->AsSurface()->SetEdgeStyle(0);
     }
     SetTileElements(std::move(tileElements));
+    PaintCacheInvalidate();
 
     gGrassSceneryTileLoopPosition = 0;
     gWidePathTileLoopPosition = {};
+    gWidePathUseDirtyTiles = true;
+    _widePathDirtyTiles.clear();
     gMapSize = size;
     gMapBaseZ = 7;
     map_remove_out_of_range_elements();
@@ -722,6 +763,148 @@ bool map_coord_is_connected(const TileCoordsXYZ& loc, uint8_t faceDirection)
     return false;
 }
 
+static uint32_t GetWidePathDirtyKey(const TileCoordsXY& tile)
+{
+    return (static_cast<uint32_t>(tile.y) << 16) | static_cast<uint32_t>(tile.x);
+}
+
+static TileCoordsXY GetWidePathDirtyTile(uint32_t key)
+{
+    return { static_cast<int32_t>(key & 0xFFFF), static_cast<int32_t>(key >> 16) };
+}
+
+static void MarkPathWideFlagsDirty(const TileCoordsXY& tile)
+{
+    if (tile.x < 0 || tile.y < 0 || tile.x >= MAXIMUM_MAP_SIZE_TECHNICAL || tile.y >= MAXIMUM_MAP_SIZE_TECHNICAL)
+        return;
+
+    _widePathDirtyTiles.insert(GetWidePathDirtyKey(tile));
+}
+
+/**
+ * Marks every tile within radius tiles of the given location so that its path wide flags are recomputed on the next
+ * tick. Any change to the path elements of a tile affects the flags of that tile and its eight neighbours, so callers
+ * that also change the edges of neighbouring paths use a radius of two.
+ */
+void map_invalidate_path_wide_flags(const CoordsXY& loc, int32_t radius)
+{
+    if (!gWidePathUseDirtyTiles)
+        return;
+
+    const auto centre = TileCoordsXY(loc);
+    for (int32_t y = centre.y - radius; y <= centre.y + radius; y++)
+    {
+        for (int32_t x = centre.x - radius; x <= centre.x + radius; x++)
+        {
+            MarkPathWideFlagsDirty({ x, y });
+        }
+    }
+}
+
+static bool TileHasPath(const CoordsXY& loc)
+{
+    for (auto* pathElement : TileElementsView<PathElement>(loc))
+    {
+        return pathElement != nullptr;
+    }
+    return false;
+}
+
+/**
+ * Marks every tile with a path, used when the flags may be out of date anywhere on the map.
+ */
+void map_invalidate_all_path_wide_flags()
+{
+    if (!gWidePathUseDirtyTiles)
+        return;
+
+    for (int32_t y = 0; y < gMapSize.y; y++)
+    {
+        for (int32_t x = 0; x < gMapSize.x; x++)
+        {
+            const auto tile = TileCoordsXY{ x, y };
+            if (TileHasPath(tile.ToCoordsXY()))
+            {
+                MarkPathWideFlagsDirty(tile);
+            }
+        }
+    }
+}
+
+/**
+ * Switches a park that still uses the rolling sweep over to dirty tile tracking.
+ */
+void map_enable_path_wide_dirty_tiles()
+{
+    if (gWidePathUseDirtyTiles)
+        return;
+
+    gWidePathUseDirtyTiles = true;
+    _widePathDirtyTiles.clear();
+    map_invalidate_all_path_wide_flags();
+}
+
+std::vector<TileCoordsXY> map_get_path_wide_dirty_tiles()
+{
+    std::vector<TileCoordsXY> tiles;
+    tiles.reserve(_widePathDirtyTiles.size());
+    for (auto key : _widePathDirtyTiles)
+    {
+        tiles.push_back(GetWidePathDirtyTile(key));
+    }
+    return tiles;
+}
+
+void map_set_path_wide_dirty_tiles(const std::vector<TileCoordsXY>& tiles)
+{
+    _widePathDirtyTiles.clear();
+    for (const auto& tile : tiles)
+    {
+        MarkPathWideFlagsDirty(tile);
+    }
+}
+
+static uint32_t GetPathWideFlags(const CoordsXY& loc)
+{
+    uint32_t flags = 0;
+    uint32_t bit = 1;
+    for (auto* pathElement : TileElementsView<PathElement>(loc))
+    {
+        if (pathElement->IsWide())
+            flags |= bit;
+        bit <<= 1;
+    }
+    return flags;
+}
+
+/**
+ * Recomputes the flags of every dirty tile. A tile only reads the wide flags of neighbours that come before it in sweep
+ * order, so visiting the tiles in that order and marking the later neighbours of any tile whose flags change gives the
+ * flags a full sweep of the map would settle on, within the tick.
+ */
+static void map_update_dirty_path_wide_flags()
+{
+    while (!_widePathDirtyTiles.empty())
+    {
+        const auto tile = GetWidePathDirtyTile(*_widePathDirtyTiles.begin());
+        _widePathDirtyTiles.erase(_widePathDirtyTiles.begin());
+
+        const auto loc = tile.ToCoordsXY();
+        if (map_get_first_element_at(loc) == nullptr)
+            continue;
+
+        const auto oldFlags = GetPathWideFlags(loc);
+        footpath_update_path_wide_flags(loc);
+        if (GetPathWideFlags(loc) != oldFlags)
+        {
+            MarkPathWideFlagsDirty({ tile.x + 1, tile.y });
+            MarkPathWideFlagsDirty({ tile.x - 1, tile.y + 1 });
+            MarkPathWideFlagsDirty({ tile.x, tile.y + 1 });
+            MarkPathWideFlagsDirty({ tile.x + 1, tile.y + 1 });
+        }
+    }
+}
+
 /**
  *
  *  rct2: 0x006A876D
@@ -735,6 +918,12 @@ void map_update_path_wide_flags()
         return;
     }
 
+    if (gWidePathUseDirtyTiles)
+    {
+        map_update_dirty_path_wide_flags();
+        return;
+    }
+
     // Presumably update_path_wide_flags is too computationally expensive to call for every
     // tile every update, so gWidePathTileLoopX and gWidePathTileLoopY store the x and y
     // progress. A maximum of 128 calls is done per update.
@@ -1084,6 +1273,12 @@ bool map_is_location_at_edge(const CoordsXY& loc)
  */
 void tile_element_remove(TileElement* tileElement)
 {
+    if (tileElement->GetType() == TileElementType::Track)
+    {
+        RidePresenceInvalidateAll();
+    }
+    MapInvalidateTileElementPointers();
+
     // Replace Nth element by (N+1)th element.
     // This loop will make tileElement point to the old last element position,
     // after copy it to it's new position
@@ -1250,6 +1445,15 @@ TileElement* tile_element_insert(const CoordsXYZ& loc, int32_t occupiedQuadrants
 
     // Set tile index pointer to point to new element block
     _tileIndex.SetTile(tileLoc, newTileElement);
+    MapInvalidateTileElementPointers();
+    if (type == TileElementType::Track)
+    {
+        RidePresenceInvalidateTile(loc);
+    }
+    else if (type == TileElementType::Path)
+    {
+        map_invalidate_path_wide_flags(loc, 1);
+    }
 
     bool isLastForTile = false;
     if (originalTileElement == nullptr)
@@ -98,6 +98,11 @@ extern const std::array<CoordsXY, 8> CoordsDirectionDelta;
 extern const TileCoordsXY TileDirectionDelta[];
 
 extern TileCoordsXY gWidePathTileLoopPosition;
+
+// When set, path wide flags are recomputed only for tiles marked by map_invalidate_path_wide_flags rather than by the
+// rolling sweep over the whole map. Parks saved by versions without dirty tile tracking keep the sweep so that they
+// (and replays of them) play back as before.
+extern bool gWidePathUseDirtyTiles;
 extern uint16_t gGrassSceneryTileLoopPosition;
 
 extern TileCoordsXY gMapSize;
@@ -147,11 +152,18 @@ extern const uint8_t tile_element_raise_styles[9][32];
 
 void ReorganiseTileElements();
 const std::vector<TileElement>& GetTileElements();
+// The number of elements on the map, unlike GetTileElements().size() this does not count the gaps left by edits.
+size_t GetTileElementsInUse();
 void SetTileElements(std::vector<TileElement>&& tileElements);
 void StashMap();
 void UnstashMap();
 std::vector<TileElement> GetReorganisedTileElementsWithoutGhosts();
 
+// Changes whenever tile elements are inserted, removed or moved, or may have been edited directly by the tile inspector
+// or a plugin. While it is unchanged a pointer found by searching a tile still points at the same element.
+uint32_t MapGetTileElementsGeneration();
+void MapInvalidateTileElementPointers();
+
 void map_init(const TileCoordsXY& size);
 
 void map_count_remaining_land_rights();
@@ -178,6 +190,11 @@ bool map_coord_is_connected(const TileCoordsXYZ& loc, uint8_t faceDirection);
 void map_remove_provisional_elements();
 void map_restore_provisional_elements();
 void map_update_path_wide_flags();
+void map_invalidate_path_wide_flags(const CoordsXY& loc, int32_t radius);
+void map_invalidate_all_path_wide_flags();
+void map_enable_path_wide_dirty_tiles();
+std::vector<TileCoordsXY> map_get_path_wide_dirty_tiles();
+void map_set_path_wide_dirty_tiles(const std::vector<TileCoordsXY>& tiles);
 bool map_is_location_valid(const CoordsXY& coords);
 bool map_is_edge(const CoordsXY& coords);
 bool map_can_build_at(const CoordsXYZ& loc);
@@ -19,6 +19,7 @@
 #include "../config/Config.h"
 #include "../core/Memory.hpp"
 #include "../core/String.hpp"
+#include "../entity/GuestHotFields.h"
 #include "../entity/Litter.h"
 #include "../entity/Peep.h"
 #include "../entity/Staff.h"
@@ -186,7 +187,7 @@ void set_forced_park_rating(int32_t rating)
 {
     _forcedParkRating = rating;
     auto& park = GetContext()->GetGameState()->GetPark();
-    gParkRating = park.CalculateParkRating();
+    gParkRating = park.CalculateParkRating(GuestHotFields::GatherShared());
     auto intent = Intent(INTENT_ACTION_UPDATE_PARK_RATING);
     context_broadcast_intent(&intent);
 }
@@ -320,7 +321,7 @@ void Park::Update(const Date& date)
     // Every ~13 seconds
     if (gCurrentTicks % 512 == 0)
     {
-        gParkRating = CalculateParkRating();
+        gParkRating = CalculateParkRating(GuestHotFields::GatherShared());
         gParkValue = CalculateParkValue();
         gCompanyValue = CalculateCompanyValue();
         gTotalRideValueForMoney = CalculateTotalRideValueForMoney();
@@ -367,7 +368,7 @@ int32_t Park::CalculateParkSize() const
     return tiles;
 }
 
-int32_t Park::CalculateParkRating() const
+int32_t Park::CalculateParkRating(const GuestHotFields& guests) const
 {
     if (_forcedParkRating >= 0)
     {
@@ -386,22 +387,8 @@ int32_t Park::CalculateParkRating() const
         result -= 150 - (std::min<int16_t>(2000, gNumGuestsInPark) / 13);
 
         // Find the number of happy peeps and the number of peeps who can't find the park exit
-        uint32_t happyGuestCount = 0;
-        uint32_t lostGuestCount = 0;
-        for (auto peep : EntityList<Guest>())
-        {
-            if (!peep->OutsideOfPark)
-            {
-                if (peep->Happiness > 128)
-                {
-                    happyGuestCount++;
-                }
-                if ((peep->PeepFlags & PEEP_FLAGS_LEAVING_PARK) && (peep->GuestIsLostCountdown < 90))
-                {
-                    lostGuestCount++;
-                }
-            }
-        }
+        uint32_t happyGuestCount = guests.CountHappierInPark(128);
+        uint32_t lostGuestCount = guests.CountLostInPark();
 
         // Peep happiness -500 to +0
         result -= 500;
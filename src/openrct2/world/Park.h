@@ -41,6 +41,7 @@ enum : uint32_t
 };
 
 struct Guest;
+struct GuestHotFields;
 struct rct_ride;
 
 namespace OpenRCT2
@@ -66,7 +67,7 @@ namespace OpenRCT2
         void Update(const Date& date);
 
         int32_t CalculateParkSize() const;
-        int32_t CalculateParkRating() const;
+        int32_t CalculateParkRating(const GuestHotFields& guests) const;
         money64 CalculateParkValue() const;
         money64 CalculateCompanyValue() const;
         static uint8_t CalculateGuestInitialHappiness(uint8_t percentage);
@@ -0,0 +1,175 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2022 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "RidePresence.h"
+
+#include "../ride/Track.h"
+#include "Map.h"
+#include "TileElementsView.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace OpenRCT2;
+
+constexpr int32_t RidePresenceBlocksPerSide = (MAXIMUM_MAP_SIZE_TECHNICAL + RidePresenceBlockSize - 1)
+    / RidePresenceBlockSize;
+constexpr size_t RidePresenceNumBlocks = RidePresenceBlocksPerSide * RidePresenceBlocksPerSide;
+
+// The set of rides with track on any tile of each block, allocated on first use.
+static std::vector<RidePresenceSet> _ridePresenceBlocks;
+static std::vector<uint8_t> _ridePresenceBlockDirty;
+
+static size_t GetBlockIndex(int32_t blockX, int32_t blockY)
+{
+    return static_cast<size_t>(blockY) * RidePresenceBlocksPerSide + blockX;
+}
+
+static void AddTileRides(RidePresenceSet& rides, const TileCoordsXY& tile)
+{
+    for (auto* trackElement : TileElementsView<TrackElement>(tile.ToCoordsXY()))
+    {
+        auto rideIndex = trackElement->GetRideIndex();
+        if (!rideIndex.IsNull())
+        {
+            rides[rideIndex.ToUnderlying()] = true;
+        }
+    }
+}
+
+static void AddRangeRides(RidePresenceSet& rides, int32_t left, int32_t top, int32_t right, int32_t bottom)
+{
+    for (int32_t x = left; x <= right; x++)
+    {
+        for (int32_t y = top; y <= bottom; y++)
+        {
+            AddTileRides(rides, { x, y });
+        }
+    }
+}
+
+static int32_t GetBlockStart(int32_t block)
+{
+    return block * RidePresenceBlockSize;
+}
+
+static int32_t GetBlockEnd(int32_t block)
+{
+    return std::min(GetBlockStart(block) + RidePresenceBlockSize, MAXIMUM_MAP_SIZE_TECHNICAL) - 1;
+}
+
+static const RidePresenceSet& GetBlock(int32_t blockX, int32_t blockY)
+{
+    if (_ridePresenceBlocks.empty())
+    {
+        _ridePresenceBlocks.resize(RidePresenceNumBlocks);
+        _ridePresenceBlockDirty.assign(RidePresenceNumBlocks, 1);
+    }
+
+    const auto index = GetBlockIndex(blockX, blockY);
+    auto& block = _ridePresenceBlocks[index];
+    if (_ridePresenceBlockDirty[index] != 0)
+    {
+        block.reset();
+        AddRangeRides(block, GetBlockStart(blockX), GetBlockStart(blockY), GetBlockEnd(blockX), GetBlockEnd(blockY));
+        _ridePresenceBlockDirty[index] = 0;
+    }
+    return block;
+}
+
+/**
+ * Clamps a range to the valid tiles of the map, returns false if no tile of the range is valid.
+ */
+static bool GetTileRange(const MapRange& range, int32_t& left, int32_t& top, int32_t& right, int32_t& bottom)
+{
+    const auto normalised = range.Normalise();
+    left = std::max(normalised.GetLeft(), 0) / COORDS_XY_STEP;
+    top = std::max(normalised.GetTop(), 0) / COORDS_XY_STEP;
+    right = std::min(normalised.GetRight(), MAXIMUM_TILE_START_XY) / COORDS_XY_STEP;
+    bottom = std::min(normalised.GetBottom(), MAXIMUM_TILE_START_XY) / COORDS_XY_STEP;
+    return normalised.GetRight() >= 0 && normalised.GetBottom() >= 0 && normalised.GetLeft() < MAXIMUM_MAP_SIZE_BIG
+        && normalised.GetTop() < MAXIMUM_MAP_SIZE_BIG;
+}
+
+void RidePresenceInvalidateTile(const CoordsXY& loc)
+{
+    if (_ridePresenceBlockDirty.empty() || !map_is_location_valid(loc))
+        return;
+
+    const auto tile = TileCoordsXY(loc);
+    _ridePresenceBlockDirty[GetBlockIndex(tile.x / RidePresenceBlockSize, tile.y / RidePresenceBlockSize)] = 1;
+}
+
+void RidePresenceInvalidateAll()
+{
+    std::fill(_ridePresenceBlockDirty.begin(), _ridePresenceBlockDirty.end(), 1);
+}
+
+void RidePresenceUpdate(const MapRange& range)
+{
+    int32_t left, top, right, bottom;
+    if (!GetTileRange(range, left, top, right, bottom))
+        return;
+
+    for (int32_t blockY = top / RidePresenceBlockSize; blockY <= bottom / RidePresenceBlockSize; blockY++)
+    {
+        for (int32_t blockX = left / RidePresenceBlockSize; blockX <= right / RidePresenceBlockSize; blockX++)
+        {
+            GetBlock(blockX, blockY);
+        }
+    }
+}
+
+RidePresenceSet RidePresenceGetRidesInRange(const MapRange& range)
+{
+    RidePresenceSet rides;
+    int32_t left, top, right, bottom;
+    if (!GetTileRange(range, left, top, right, bottom))
+        return rides;
+
+    const auto blockLeft = left / RidePresenceBlockSize;
+    const auto blockTop = top / RidePresenceBlockSize;
+    const auto blockRight = right / RidePresenceBlockSize;
+    const auto blockBottom = bottom / RidePresenceBlockSize;
+
+    // Blocks entirely inside the range contribute all of their rides.
+    for (int32_t blockY = blockTop; blockY <= blockBottom; blockY++)
+    {
+        for (int32_t blockX = blockLeft; blockX <= blockRight; blockX++)
+        {
+            if (GetBlockStart(blockX) >= left && GetBlockEnd(blockX) <= right && GetBlockStart(blockY) >= top
+                && GetBlockEnd(blockY) <= bottom)
+            {
+                rides |= GetBlock(blockX, blockY);
+            }
+        }
+    }
+
+    // Blocks on the edge of the range only need their overlapping tiles walked when they have a ride that has not
+    // been found yet.
+    for (int32_t blockY = blockTop; blockY <= blockBottom; blockY++)
+    {
+        for (int32_t blockX = blockLeft; blockX <= blockRight; blockX++)
+        {
+            const auto x1 = std::max(GetBlockStart(blockX), left);
+            const auto y1 = std::max(GetBlockStart(blockY), top);
+            const auto x2 = std::min(GetBlockEnd(blockX), right);
+            const auto y2 = std::min(GetBlockEnd(blockY), bottom);
+            if (x1 == GetBlockStart(blockX) && x2 == GetBlockEnd(blockX) && y1 == GetBlockStart(blockY)
+                && y2 == GetBlockEnd(blockY))
+                continue;
+
+            if ((GetBlock(blockX, blockY) & ~rides).count() == 0)
+                continue;
+
+            AddRangeRides(rides, x1, y1, x2, y2);
+        }
+    }
+    return rides;
+}
@@ -0,0 +1,43 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2022 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../Limits.h"
+#include "../core/BitSet.hpp"
+#include "Location.hpp"
+
+using RidePresenceSet = OpenRCT2::BitSet<OpenRCT2::Limits::MaxRidesInPark>;
+
+// Size in tiles of one side of a ride presence block.
+constexpr int32_t RidePresenceBlockSize = 8;
+
+/**
+ * Marks the block containing the given tile for rebuilding, this must be called whenever a track element is
+ * inserted at or its ride index changed on that tile.
+ */
+void RidePresenceInvalidateTile(const CoordsXY& loc);
+
+/**
+ * Marks every block for rebuilding. Used when the map is replaced or when a track element is removed, as the
+ * removal does not know the tile of the element.
+ */
+void RidePresenceInvalidateAll();
+
+/**
+ * Rebuilds all invalidated blocks that overlap the given range. After this, queries within the range do not
+ * modify any shared state and can run concurrently.
+ */
+void RidePresenceUpdate(const MapRange& range);
+
+/**
+ * Returns the set of ride indices that have a track element on any valid tile within the inclusive range. The
+ * result is identical to walking the track elements of every tile in the range.
+ */
+RidePresenceSet RidePresenceGetRidesInRange(const MapRange& range);
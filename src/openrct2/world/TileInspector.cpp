@@ -27,6 +27,7 @@
 #include "LargeScenery.h"
 #include "Map.h"
 #include "Park.h"
+#include "RidePresence.h"
 #include "Scenery.h"
 #include "Surface.h"
 
@@ -358,6 +359,7 @@ namespace OpenRCT2::TileInspector
             bool lastForTile = pastedElement->IsLastForTile();
             *pastedElement = element;
             pastedElement->SetLastForTile(lastForTile);
+            RidePresenceInvalidateTile(loc);
 
             map_invalidate_tile_full(loc);
 
@@ -0,0 +1,89 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2022 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <openrct2/entity/EntityIdSet.h>
+#include <vector>
+
+static std::vector<uint16_t> ToVector(const EntityIdSet& set)
+{
+    std::vector<uint16_t> res;
+    for (auto id : set)
+    {
+        res.push_back(id.ToUnderlying());
+    }
+    return res;
+}
+
+TEST(EntityIdSetTest, empty)
+{
+    EntityIdSet set;
+    ASSERT_TRUE(set.empty());
+    ASSERT_EQ(set.size(), 0u);
+    ASSERT_TRUE(set.begin() == set.end());
+}
+
+TEST(EntityIdSetTest, iterates_in_index_order)
+{
+    EntityIdSet set;
+    for (uint16_t id : { 40000, 3, 64, 63, 65534, 0, 4096 })
+    {
+        ASSERT_TRUE(set.insert(EntityId::FromUnderlying(id)));
+    }
+    ASSERT_FALSE(set.insert(EntityId::FromUnderlying(63)));
+    ASSERT_FALSE(set.insert(EntityId::GetNull()));
+
+    ASSERT_EQ(set.size(), 7u);
+    ASSERT_EQ(ToVector(set), (std::vector<uint16_t>{ 0, 3, 63, 64, 4096, 40000, 65534 }));
+}
+
+TEST(EntityIdSetTest, erase)
+{
+    EntityIdSet set;
+    for (uint16_t id : { 1, 2, 500, 30000 })
+    {
+        set.insert(EntityId::FromUnderlying(id));
+    }
+    ASSERT_TRUE(set.erase(EntityId::FromUnderlying(500)));
+    ASSERT_FALSE(set.erase(EntityId::FromUnderlying(500)));
+    ASSERT_FALSE(set.contains(EntityId::FromUnderlying(500)));
+    ASSERT_TRUE(set.contains(EntityId::FromUnderlying(30000)));
+    ASSERT_EQ(ToVector(set), (std::vector<uint16_t>{ 1, 2, 30000 }));
+
+    set.clear();
+    ASSERT_TRUE(set.empty());
+    ASSERT_TRUE(set.begin() == set.end());
+}
+
+TEST(EntityIdSetTest, mutation_during_iteration)
+{
+    EntityIdSet set;
+    for (uint16_t id : { 10, 20, 30 })
+    {
+        set.insert(EntityId::FromUnderlying(id));
+    }
+
+    // Same semantics as the previous std::list backed lists: the current id may be
+    // removed and ids inserted past the iterator position are visited.
+    std::vector<uint16_t> visited;
+    for (auto it = set.begin(); it != set.end();)
+    {
+        auto id = *it++;
+        visited.push_back(id.ToUnderlying());
+        set.erase(id);
+        if (id.ToUnderlying() == 20)
+        {
+            set.insert(EntityId::FromUnderlying(5));
+            set.insert(EntityId::FromUnderlying(25));
+            set.insert(EntityId::FromUnderlying(35));
+        }
+    }
+    ASSERT_EQ(visited, (std::vector<uint16_t>{ 10, 20, 30, 35 }));
+    ASSERT_EQ(ToVector(set), (std::vector<uint16_t>{ 5, 25 }));
+}
@@ -33,6 +33,37 @@ public:
         }
         return hash;
     }
+
+    // A sheet of colours that are mostly not in the palette, with a partially transparent quarter.
+    static Image CreateGradientImage()
+    {
+        Image image;
+        image.Width = 256;
+        image.Height = 256;
+        image.Depth = 32;
+        image.Stride = image.Width * 4;
+        image.Pixels.resize(image.Stride * image.Height);
+        for (uint32_t y = 0; y < image.Height; y++)
+        {
+            for (uint32_t x = 0; x < image.Width; x++)
+            {
+                auto pixel = &image.Pixels[y * image.Stride + x * 4];
+                pixel[0] = static_cast<uint8_t>(x);
+                pixel[1] = static_cast<uint8_t>(y);
+                pixel[2] = static_cast<uint8_t>((x * 3 + y * 5) / 8);
+                pixel[3] = (x < 64 && y < 64) ? static_cast<uint8_t>(x * 4) : 255;
+            }
+        }
+        return image;
+    }
+
+    static uint32_t ImportGradient(ImageImporter::ImportMode mode)
+    {
+        ImageImporter importer;
+        auto image = CreateGradientImage();
+        auto result = importer.Import(image, 0, 0, ImageImporter::Palette::OpenRCT2, ImageImporter::ImportFlags::None, mode);
+        return GetHash(result.Buffer.data(), result.Buffer.size());
+    }
 };
 
 TEST_F(ImageImporterTests, Import_Logo)
@@ -56,3 +87,25 @@ TEST_F(ImageImporterTests, Import_Logo)
     auto hash = GetHash(result.Buffer.data(), result.Buffer.size());
     ASSERT_EQ(0xCEF27C7D, hash);
 }
+
+TEST_F(ImageImporterTests, Import_Logo_Dithering)
+{
+    auto logoPath = GetImagePath("logo.png");
+
+    ImageImporter importer;
+    auto image = Imaging::ReadFromFile(logoPath, IMAGE_FORMAT::PNG_32);
+    auto result = importer.Import(
+        image, 0, 0, ImageImporter::Palette::OpenRCT2, ImageImporter::ImportFlags::RLE,
+        ImageImporter::ImportMode::Dithering);
+
+    auto hash = GetHash(result.Buffer.data(), result.Buffer.size());
+    ASSERT_EQ(0x2ABFC1B7, hash);
+}
+
+TEST_F(ImageImporterTests, Import_Gradient)
+{
+    // The colours have to match the same palette entries as a search of the whole palette would.
+    ASSERT_EQ(0x1FAC011A, ImportGradient(ImageImporter::ImportMode::Default));
+    ASSERT_EQ(0x7FE5E8E0, ImportGradient(ImageImporter::ImportMode::Closest));
+    ASSERT_EQ(0xAF48104B, ImportGradient(ImageImporter::ImportMode::Dithering));
+}
@@ -0,0 +1,95 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2022 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <openrct2/core/JobPool.h>
+#include <thread>
+#include <vector>
+
+TEST(JobPoolTest, parallel_for_runs_every_index_once)
+{
+    JobPool jobPool;
+    for (size_t count : { 0, 1, 2, 7, 64, 1000 })
+    {
+        std::vector<std::atomic<uint32_t>> calls(count);
+        jobPool.ParallelFor(count, [&calls](size_t index) { calls[index]++; });
+        for (size_t i = 0; i < count; i++)
+        {
+            ASSERT_EQ(calls[i], 1U);
+        }
+    }
+}
+
+TEST(JobPoolTest, parallel_for_uneven_work)
+{
+    // The first indices are far more expensive, the other threads have to steal them from the first share.
+    constexpr size_t Count = 256;
+    JobPool jobPool;
+    std::vector<std::atomic<uint32_t>> calls(Count);
+    std::vector<std::thread::id> threads(Count);
+    jobPool.ParallelFor(Count, [&](size_t index) {
+        if (index < Count / 8)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        threads[index] = std::this_thread::get_id();
+        calls[index]++;
+    });
+
+    for (size_t i = 0; i < Count; i++)
+    {
+        ASSERT_EQ(calls[i], 1U);
+    }
+    if (std::thread::hardware_concurrency() > 1)
+    {
+        auto firstShareThread = threads[0];
+        bool stolen = false;
+        for (size_t i = 1; i < Count / 8; i++)
+        {
+            stolen |= threads[i] != firstShareThread;
+        }
+        ASSERT_TRUE(stolen);
+    }
+}
+
+TEST(JobPoolTest, parallel_for_after_tasks)
+{
+    JobPool jobPool;
+    std::atomic<uint32_t> tasks{};
+    for (int32_t i = 0; i < 100; i++)
+    {
+        jobPool.AddTask([&tasks]() { tasks++; });
+    }
+    jobPool.Join();
+    ASSERT_EQ(tasks, 100U);
+
+    for (int32_t run = 0; run < 100; run++)
+    {
+        std::atomic<uint32_t> total{};
+        jobPool.ParallelFor(100, [&total](size_t index) { total += static_cast<uint32_t>(index); });
+        ASSERT_EQ(total, 4950U);
+    }
+}
+
+TEST(JobPoolTest, parallel_for_nested)
+{
+    JobPool jobPool;
+    constexpr size_t Count = 64;
+    std::vector<std::atomic<uint32_t>> calls(Count * Count);
+    jobPool.ParallelFor(Count, [&jobPool, &calls](size_t outer) {
+        jobPool.ParallelFor(Count, [&calls, outer](size_t inner) { calls[outer * Count + inner]++; });
+    });
+
+    for (const auto& call : calls)
+    {
+        ASSERT_EQ(call, 1U);
+    }
+}
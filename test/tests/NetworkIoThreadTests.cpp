@@ -0,0 +1,194 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2022 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifndef DISABLE_NETWORK
+
+#    include <chrono>
+#    include <gtest/gtest.h>
+#    include <limits>
+#    include <memory>
+#    include <openrct2/network/NetworkConnection.h>
+#    include <openrct2/network/NetworkIoThread.h>
+#    include <openrct2/network/Socket.h>
+#    include <thread>
+#    include <vector>
+
+constexpr size_t NumClients = 16;
+constexpr uint32_t NumPacketsPerClient = 2000;
+constexpr uint32_t NumBroadcasts = 500;
+constexpr auto Timeout = std::chrono::seconds(60);
+constexpr uint32_t UnknownSender = std::numeric_limits<uint32_t>::max();
+
+class NetworkIoThreadTest : public testing::Test
+{
+protected:
+    std::unique_ptr<ITcpSocket> _listenSocket;
+    std::vector<std::unique_ptr<NetworkConnection>> _clients;
+    std::vector<std::unique_ptr<NetworkConnection>> _serverConnections;
+
+    void SetUp() override
+    {
+        // Find a free port on the loopback interface.
+        uint16_t port = 0;
+        for (uint16_t candidate = 11760; candidate < 11860 && port == 0; candidate++)
+        {
+            try
+            {
+                _listenSocket = CreateTcpSocket();
+                _listenSocket->Listen("127.0.0.1", candidate);
+                port = candidate;
+            }
+            catch (const std::exception&)
+            {
+            }
+        }
+        ASSERT_NE(port, 0);
+
+        for (size_t i = 0; i < NumClients; i++)
+        {
+            auto client = std::make_unique<NetworkConnection>();
+            client->Socket = CreateTcpSocket();
+            client->Socket->Connect("127.0.0.1", port);
+            client->AuthStatus = NetworkAuth::Ok;
+            _clients.push_back(std::move(client));
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        while (_serverConnections.size() < NumClients)
+        {
+            ASSERT_LT(std::chrono::steady_clock::now() - start, Timeout);
+            auto socket = _listenSocket->Accept();
+            if (socket == nullptr)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            auto connection = std::make_unique<NetworkConnection>();
+            connection->Socket = std::move(socket);
+            connection->AuthStatus = NetworkAuth::Ok;
+            _serverConnections.push_back(std::move(connection));
+        }
+    }
+
+    static NetworkPacket CreatePacket(uint32_t sender, uint32_t sequence)
+    {
+        NetworkPacket packet(NetworkCommand::Chat);
+        packet << sender << sequence;
+        packet.WriteString(std::string(sequence % 300, 'x'));
+        return packet;
+    }
+
+    // Reads the next packet from the connection and checks it is the expected one, returns false if none is ready. An
+    // unknown sender is taken from the first packet.
+    static bool ReadExpectedPacket(NetworkConnection& connection, uint32_t& sender, uint32_t& nextSequence)
+    {
+        if (connection.ReadPacket() != NetworkReadPacket::Success)
+            return false;
+
+        auto& packet = connection.InboundPacket;
+        uint32_t packetSender{};
+        uint32_t packetSequence{};
+        packet >> packetSender >> packetSequence;
+        if (sender == UnknownSender)
+        {
+            sender = packetSender;
+        }
+        EXPECT_EQ(packet.GetCommand(), NetworkCommand::Chat);
+        EXPECT_EQ(packetSender, sender);
+        EXPECT_EQ(packetSequence, nextSequence);
+        EXPECT_EQ(packet.ReadString().size(), nextSequence % 300);
+        packet.Clear();
+        nextSequence++;
+        return true;
+    }
+};
+
+TEST_F(NetworkIoThreadTest, loopback_stress)
+{
+    NetworkIoThread ioThread;
+    for (auto& connection : _serverConnections)
+    {
+        ioThread.AddConnection(*connection);
+    }
+
+    // Clients send on their own, the server receives through the I/O thread and broadcasts shared packets back.
+    for (size_t i = 0; i < NumClients; i++)
+    {
+        for (uint32_t sequence = 0; sequence < NumPacketsPerClient; sequence++)
+        {
+            _clients[i]->QueuePacket(CreatePacket(static_cast<uint32_t>(i), sequence));
+        }
+    }
+    for (uint32_t sequence = 0; sequence < NumBroadcasts; sequence++)
+    {
+        auto packet = std::make_shared<const NetworkPacket>(CreatePacket(NumClients, sequence));
+        for (auto& connection : _serverConnections)
+        {
+            connection->QueuePacket(packet);
+        }
+    }
+
+    // Connections are accepted in no particular order, so the server identifies clients by their first packet.
+    std::vector<uint32_t> serverSenders(NumClients, UnknownSender);
+    std::vector<uint32_t> serverReceived(NumClients);
+    std::vector<uint32_t> clientReceived(NumClients);
+    const auto start = std::chrono::steady_clock::now();
+    bool done = false;
+    while (!done)
+    {
+        ASSERT_LT(std::chrono::steady_clock::now() - start, Timeout);
+
+        for (auto& client : _clients)
+        {
+            client->SendQueuedPackets();
+        }
+        for (auto& connection : _serverConnections)
+        {
+            connection->SendQueuedPackets();
+        }
+        ioThread.Wake();
+
+        done = true;
+        for (size_t i = 0; i < NumClients; i++)
+        {
+            while (ReadExpectedPacket(*_serverConnections[i], serverSenders[i], serverReceived[i]))
+            {
+            }
+
+            auto broadcastSender = static_cast<uint32_t>(NumClients);
+            while (ReadExpectedPacket(*_clients[i], broadcastSender, clientReceived[i]))
+            {
+            }
+            done &= serverReceived[i] == NumPacketsPerClient && clientReceived[i] == NumBroadcasts;
+        }
+        std::this_thread::yield();
+    }
+
+    // Every client was identified exactly once.
+    std::vector<bool> seen(NumClients);
+    for (auto sender : serverSenders)
+    {
+        ASSERT_LT(sender, NumClients);
+        ASSERT_FALSE(seen[sender]);
+        seen[sender] = true;
+    }
+
+    for (auto& connection : _serverConnections)
+    {
+        ioThread.RemoveConnection(*connection);
+
+        // Broadcast packets are packed together, so far fewer sends are made than packets queued.
+        auto stats = connection->GetStats();
+        ASSERT_GT(stats.bytesCopied, 0U);
+        ASSERT_LT(stats.sendCalls, NumBroadcasts);
+    }
+}
+
+#endif // DISABLE_NETWORK
@@ -0,0 +1,154 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2022 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TestData.h"
+
+#include <gtest/gtest.h>
+#include <openrct2/Context.h>
+#include <openrct2/Game.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/ParkImporter.h>
+#include <openrct2/config/Config.h>
+#include <openrct2/drawing/LightFX.h>
+#include <openrct2/drawing/X8DrawingEngine.h>
+#include <openrct2/interface/Viewport.h>
+#include <openrct2/interface/Window_internal.h>
+#include <openrct2/paint/PaintCache.h>
+#include <openrct2/platform/Platform.h>
+#include <openrct2/world/Map.h>
+#include <vector>
+
+using namespace OpenRCT2;
+using namespace OpenRCT2::Drawing;
+
+class PaintCacheTests : public testing::Test
+{
+protected:
+    static constexpr int32_t ViewportWidth = 640;
+    static constexpr int32_t ViewportHeight = 480;
+
+    static void SetUpTestCase()
+    {
+        Platform::CoreInit();
+
+        // Painting needs the sprites, so unlike most tests the graphics are loaded.
+        gOpenRCT2Headless = true;
+        gOpenRCT2NoGraphics = false;
+        _context = CreateContext();
+        const bool initialised = _context->Initialise();
+        ASSERT_TRUE(initialised);
+
+        std::string parkPath = TestData::GetParkPath("bpb.sv6");
+        load_from_sv6(parkPath.c_str());
+        game_load_init();
+    }
+
+    void TearDown() override
+    {
+        gConfigGeneral.cache_static_tiles = false;
+        gConfigGeneral.enable_light_fx = false;
+        PaintCacheInvalidate();
+    }
+
+    static void TearDownTestCase()
+    {
+        _context = nullptr;
+    }
+
+    static std::vector<uint8_t> Render(const rct_viewport& viewport)
+    {
+        std::vector<uint8_t> pixels(static_cast<size_t>(viewport.width) * viewport.height);
+        X8DrawingEngine drawingEngine(_context->GetUiContext());
+
+        rct_drawpixelinfo dpi;
+        dpi.bits = pixels.data();
+        dpi.width = viewport.width;
+        dpi.height = viewport.height;
+        dpi.DrawingEngine = &drawingEngine;
+        viewport_render(&dpi, &viewport, { { 0, 0 }, { viewport.width, viewport.height } });
+        return pixels;
+    }
+
+    // The cache is only used for viewports of windows, so the viewport is created for a window.
+    static void TestCachedPaintMatchesUncached(ZoomLevel zoom)
+    {
+        rct_window w{};
+        const auto centre = GetMapSizeUnits() / 2;
+        viewport_create(&w, { 0, 0 }, ViewportWidth, ViewportHeight, Focus(CoordsXYZ{ centre, 0 }, zoom));
+        ASSERT_NE(w.viewport, nullptr);
+
+        gConfigGeneral.cache_static_tiles = false;
+        const auto uncached = Render(*w.viewport);
+
+        // The first paint records the tiles, the second one replays them.
+        gConfigGeneral.cache_static_tiles = true;
+        const auto recorded = Render(*w.viewport);
+        const auto replayed = Render(*w.viewport);
+
+        viewport_remove(w.viewport);
+
+        EXPECT_EQ(uncached, recorded);
+        EXPECT_EQ(uncached, replayed);
+    }
+
+#ifdef __ENABLE_LIGHTFX__
+    static uint32_t RenderLights(const rct_viewport& viewport)
+    {
+        lightfx_swap_buffers();
+        Render(viewport);
+        return lightfx_get_light_count();
+    }
+
+    // Lights are added while tiles are painted rather than drawn, so the pixels do not show lights that are lost.
+    static void TestCachedPaintAddsTheSameLights(ZoomLevel zoom)
+    {
+        gConfigGeneral.enable_light_fx = true;
+
+        // Zoomed out far enough to show the whole park with its entrances.
+        rct_window w{};
+        const auto centre = GetMapSizeUnits() / 2;
+        viewport_create(&w, { 0, 0 }, ViewportWidth * 2, ViewportHeight * 2, Focus(CoordsXYZ{ centre, 0 }, zoom));
+        ASSERT_NE(w.viewport, nullptr);
+
+        gConfigGeneral.cache_static_tiles = false;
+        const auto uncached = RenderLights(*w.viewport);
+
+        gConfigGeneral.cache_static_tiles = true;
+        const auto recorded = RenderLights(*w.viewport);
+        const auto replayed = RenderLights(*w.viewport);
+
+        viewport_remove(w.viewport);
+
+        EXPECT_GT(uncached, 0u);
+        EXPECT_EQ(uncached, recorded);
+        EXPECT_EQ(uncached, replayed);
+    }
+#endif
+
+    static std::shared_ptr<IContext> _context;
+};
+
+std::shared_ptr<IContext> PaintCacheTests::_context;
+
+TEST_F(PaintCacheTests, cached_paint_matches_uncached)
+{
+    TestCachedPaintMatchesUncached(ZoomLevel{ 0 });
+}
+
+TEST_F(PaintCacheTests, cached_paint_matches_uncached_zoomed_out)
+{
+    TestCachedPaintMatchesUncached(ZoomLevel{ 2 });
+}
+
+#ifdef __ENABLE_LIGHTFX__
+TEST_F(PaintCacheTests, cached_paint_adds_the_same_lights)
+{
+    TestCachedPaintAddsTheSameLights(ZoomLevel{ 3 });
+}
+#endif
@@ -0,0 +1,204 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2022 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TestData.h"
+
+#include <gtest/gtest.h>
+#include <openrct2/Cheats.h>
+#include <openrct2/Context.h>
+#include <openrct2/Game.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/actions/FootpathPlaceAction.h>
+#include <openrct2/actions/FootpathRemoveAction.h>
+#include <openrct2/platform/Platform.h>
+#include <openrct2/world/Footpath.h>
+#include <openrct2/world/Map.h>
+#include <openrct2/world/Park.h>
+#include <openrct2/world/Surface.h>
+#include <openrct2/world/TileElementsView.h>
+#include <vector>
+
+using namespace OpenRCT2;
+
+class PathWideFlagsTest : public testing::Test
+{
+protected:
+    struct PathLocation
+    {
+        CoordsXYZ Location;
+
+        // A copy, placing paths can move the tile elements.
+        PathElement Element;
+    };
+
+    static void SetUpTestCase()
+    {
+        Platform::CoreInit();
+
+        gOpenRCT2Headless = true;
+        gOpenRCT2NoGraphics = true;
+        _context = CreateContext();
+        const bool initialised = _context->Initialise();
+        ASSERT_TRUE(initialised);
+
+        std::string parkPath = TestData::GetParkPath("bpb.sv6");
+        load_from_sv6(parkPath.c_str());
+        game_load_init();
+
+        gCheatsSandboxMode = true;
+        gCheatsDisableClearanceChecks = true;
+        gParkFlags |= PARK_FLAGS_NO_MONEY;
+
+        // Imported saves keep the rolling sweep, switching marks every path so that the flags settle.
+        map_enable_path_wide_dirty_tiles();
+        map_update_path_wide_flags();
+    }
+
+    static void TearDownTestCase()
+    {
+        gCheatsSandboxMode = false;
+        gCheatsDisableClearanceChecks = false;
+        _context = nullptr;
+    }
+
+    // One bit per path element of each tile, set when the path is wide.
+    static std::vector<uint32_t> GetWideFlags()
+    {
+        std::vector<uint32_t> flags;
+        for (int32_t y = 0; y < gMapSize.y; y++)
+        {
+            for (int32_t x = 0; x < gMapSize.x; x++)
+            {
+                uint32_t tileFlags = 0;
+                uint32_t bit = 1;
+                for (auto* pathElement : TileElementsView<PathElement>(TileCoordsXY{ x, y }.ToCoordsXY()))
+                {
+                    if (pathElement->IsWide())
+                        tileFlags |= bit;
+                    bit <<= 1;
+                }
+                flags.push_back(tileFlags);
+            }
+        }
+        return flags;
+    }
+
+    // The rolling sweep the dirty tiles replace, run over the whole map once.
+    static void UpdateWideFlagsWithSweep()
+    {
+        gWidePathUseDirtyTiles = false;
+        gWidePathTileLoopPosition = {};
+        constexpr int32_t numTiles = MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL;
+        for (int32_t i = 0; i < (numTiles + 127) / 128; i++)
+        {
+            map_update_path_wide_flags();
+        }
+        gWidePathUseDirtyTiles = true;
+    }
+
+    static std::vector<PathLocation> GetFlatPaths(bool wide)
+    {
+        std::vector<PathLocation> paths;
+        for (int32_t y = 1; y < gMapSize.y - 1; y++)
+        {
+            for (int32_t x = 1; x < gMapSize.x - 1; x++)
+            {
+                const auto location = TileCoordsXY{ x, y }.ToCoordsXY();
+                for (auto* pathElement : TileElementsView<PathElement>(location))
+                {
+                    if (!pathElement->IsQueue() && !pathElement->IsSloped() && pathElement->IsWide() == wide)
+                    {
+                        paths.push_back({ { location, pathElement->GetBaseZ() }, *pathElement });
+                    }
+                }
+            }
+        }
+        return paths;
+    }
+
+    static bool IsEmptyFlatTile(const CoordsXYZ& location)
+    {
+        if (map_is_edge(location))
+            return false;
+
+        auto* tileElement = map_get_first_element_at(location);
+        if (tileElement == nullptr || !tileElement->IsLastForTile())
+            return false;
+
+        const auto* surfaceElement = tileElement->AsSurface();
+        return surfaceElement != nullptr && surfaceElement->GetSlope() == TILE_ELEMENT_SLOPE_FLAT
+            && surfaceElement->GetBaseZ() == location.z;
+    }
+
+    static GameActions::Result PlacePath(const CoordsXYZ& location, const PathElement& like, bool queue, uint32_t flags)
+    {
+        PathConstructFlags constructFlags = queue ? PathConstructFlag::IsQueue : 0;
+        auto type = like.GetSurfaceEntryIndex();
+        if (like.HasLegacyPathEntry())
+        {
+            constructFlags |= PathConstructFlag::IsLegacyPathObject;
+            type = like.GetLegacyPathEntryIndex();
+        }
+        auto action = FootpathPlaceAction(
+            location, TILE_ELEMENT_SLOPE_FLAT, type, like.GetRailingsEntryIndex(), INVALID_DIRECTION, constructFlags);
+        action.SetFlags(flags);
+        return GameActions::Execute(&action);
+    }
+
+    static std::shared_ptr<IContext> _context;
+};
+
+std::shared_ptr<IContext> PathWideFlagsTest::_context;
+
+TEST_F(PathWideFlagsTest, dirty_tiles_match_sweep_after_path_edits)
+{
+    const auto widePaths = GetFlatPaths(true);
+    ASSERT_GE(widePaths.size(), 2u);
+
+    // Track designs update existing paths without touching their edges.
+    const auto queued = widePaths.front();
+    const auto queueResult = PlacePath(queued.Location, queued.Element, true, GAME_COMMAND_FLAG_TRACK_DESIGN);
+    ASSERT_EQ(queueResult.Error, GameActions::Status::Ok);
+
+    const auto removed = widePaths.back();
+    auto removeAction = FootpathRemoveAction(removed.Location);
+    ASSERT_EQ(GameActions::Execute(&removeAction).Error, GameActions::Status::Ok);
+
+    // Widen a few paths by placing paths on the empty tiles next to them.
+    int32_t numPlaced = 0;
+    for (const auto& path : GetFlatPaths(false))
+    {
+        if (numPlaced == 8)
+            break;
+
+        for (Direction direction : ALL_DIRECTIONS)
+        {
+            const auto location = CoordsXYZ{ CoordsXY{ path.Location } + CoordsDirectionDelta[direction], path.Location.z };
+            if (IsEmptyFlatTile(location))
+            {
+                ASSERT_EQ(PlacePath(location, path.Element, false, 0).Error, GameActions::Status::Ok);
+                numPlaced++;
+                break;
+            }
+        }
+    }
+    ASSERT_GT(numPlaced, 0);
+
+    const auto staleFlags = GetWideFlags();
+    map_update_path_wide_flags();
+    const auto dirtyTileFlags = GetWideFlags();
+    UpdateWideFlagsWithSweep();
+    const auto sweepFlags = GetWideFlags();
+
+    ASSERT_NE(staleFlags, sweepFlags);
+    for (size_t i = 0; i < sweepFlags.size(); i++)
+    {
+        ASSERT_EQ(dirtyTileFlags[i], sweepFlags[i]) << "at " << i % gMapSize.x << ", " << i / gMapSize.x;
+    }
+}
@@ -0,0 +1,153 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2022 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+#include <openrct2/core/JobPool.h>
+#include <openrct2/profiling/Profiling.h>
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace OpenRCT2;
+
+static void ProfiledLeaf()
+{
+    PROFILED_FUNCTION();
+}
+
+static void ProfiledParent()
+{
+    PROFILED_FUNCTION();
+    ProfiledLeaf();
+}
+
+static nlohmann::json GetTrace()
+{
+    std::stringstream out;
+    Profiling::WriteTrace(out);
+    return nlohmann::json::parse(out.str());
+}
+
+static Profiling::Function* FindFunction(const char* name)
+{
+    for (auto* func : Profiling::GetData())
+    {
+        if (std::string(func->GetName()).find(name) != std::string::npos)
+        {
+            return func;
+        }
+    }
+    return nullptr;
+}
+
+static size_t CountEvents(const nlohmann::json& trace, const char* name)
+{
+    size_t count = 0;
+    for (const auto& event : trace["traceEvents"])
+    {
+        if (event["ph"] == "X" && event["name"].get<std::string>().find(name) != std::string::npos)
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+TEST(ProfilingTest, trace_records_complete_events)
+{
+    Profiling::Enable();
+    Profiling::StartTrace();
+    for (int32_t i = 0; i < 10; i++)
+    {
+        ProfiledParent();
+    }
+    Profiling::StopTrace();
+    ProfiledParent();
+    Profiling::Disable();
+
+    auto trace = GetTrace();
+    ASSERT_EQ(CountEvents(trace, "ProfiledParent"), 10U);
+    ASSERT_EQ(CountEvents(trace, "ProfiledLeaf"), 10U);
+    for (const auto& event : trace["traceEvents"])
+    {
+        if (event["ph"] == "X")
+        {
+            ASSERT_GE(event["ts"].get<double>(), 0.0);
+            ASSERT_GE(event["dur"].get<double>(), 0.0);
+        }
+    }
+    ASSERT_EQ(trace["otherData"]["droppedEvents"], 0);
+}
+
+TEST(ProfilingTest, trace_records_every_thread)
+{
+    JobPool jobPool;
+    Profiling::Enable();
+    Profiling::StartTrace();
+    jobPool.ParallelFor(1000, [](size_t) { ProfiledLeaf(); });
+    Profiling::StopTrace();
+    Profiling::Disable();
+
+    auto trace = GetTrace();
+    ASSERT_EQ(CountEvents(trace, "ProfiledLeaf"), 1000U);
+
+    size_t numThreads = 0;
+    for (const auto& event : trace["traceEvents"])
+    {
+        if (event["ph"] == "M" && event["name"] == "thread_name")
+        {
+            numThreads++;
+        }
+    }
+    ASSERT_GE(numThreads, 1U);
+}
+
+TEST(ProfilingTest, start_trace_discards_previous_events)
+{
+    Profiling::Enable();
+    Profiling::StartTrace();
+    ProfiledLeaf();
+    Profiling::StartTrace();
+    ProfiledLeaf();
+    Profiling::StopTrace();
+    Profiling::Disable();
+
+    ASSERT_EQ(CountEvents(GetTrace(), "ProfiledLeaf"), 1U);
+}
+
+TEST(ProfilingTest, statistics_merge_every_thread)
+{
+    Profiling::ResetData();
+    Profiling::Enable();
+    ProfiledParent();
+    std::thread worker([] {
+        ProfiledParent();
+        ProfiledParent();
+    });
+    worker.join();
+    Profiling::Disable();
+
+    auto* parent = FindFunction("ProfiledParent");
+    auto* leaf = FindFunction("ProfiledLeaf");
+    ASSERT_NE(parent, nullptr);
+    ASSERT_NE(leaf, nullptr);
+    ASSERT_EQ(parent->GetCallCount(), 3U);
+    ASSERT_EQ(leaf->GetCallCount(), 3U);
+    ASSERT_EQ(leaf->GetTimeSamples().size(), 3U);
+    ASSERT_GE(parent->GetTotalTime(), leaf->GetTotalTime());
+    ASSERT_LE(leaf->GetMinTime(), leaf->GetMaxTime());
+    ASSERT_EQ(leaf->GetParents(), std::vector<Profiling::Function*>{ parent });
+    ASSERT_EQ(parent->GetChildren(), std::vector<Profiling::Function*>{ leaf });
+
+    Profiling::ResetData();
+    ASSERT_EQ(parent->GetCallCount(), 0U);
+    ASSERT_EQ(leaf->GetMinTime(), 0.0);
+    ASSERT_TRUE(leaf->GetParents().empty());
+}
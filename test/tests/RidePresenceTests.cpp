@@ -0,0 +1,164 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2022 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TestData.h"
+
+#include <gtest/gtest.h>
+#include <openrct2/Context.h>
+#include <openrct2/Game.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/entity/EntityList.h>
+#include <openrct2/entity/Guest.h>
+#include <openrct2/platform/Platform.h>
+#include <openrct2/ride/Ride.h>
+#include <openrct2/ride/Track.h>
+#include <openrct2/world/Map.h>
+#include <openrct2/world/RidePresence.h>
+#include <openrct2/world/TileElementsView.h>
+
+using namespace OpenRCT2;
+
+class RidePresenceTest : public testing::Test
+{
+protected:
+    static void SetUpTestCase()
+    {
+        Platform::CoreInit();
+
+        gOpenRCT2Headless = true;
+        gOpenRCT2NoGraphics = true;
+        _context = CreateContext();
+        const bool initialised = _context->Initialise();
+        ASSERT_TRUE(initialised);
+
+        std::string parkPath = TestData::GetParkPath("bpb.sv6");
+        load_from_sv6(parkPath.c_str());
+        game_load_init();
+    }
+
+    static void TearDownTestCase()
+    {
+        _context = nullptr;
+    }
+
+    // The tile walk previously done by the guest ride searches.
+    static RidePresenceSet ScanRidesInRange(const MapRange& range)
+    {
+        RidePresenceSet rides;
+        for (int32_t x = range.GetLeft(); x <= range.GetRight(); x += COORDS_XY_STEP)
+        {
+            for (int32_t y = range.GetTop(); y <= range.GetBottom(); y += COORDS_XY_STEP)
+            {
+                auto location = CoordsXY{ x, y };
+                if (!map_is_location_valid(location))
+                    continue;
+
+                for (auto* trackElement : TileElementsView<TrackElement>(location))
+                {
+                    auto rideIndex = trackElement->GetRideIndex();
+                    if (!rideIndex.IsNull())
+                    {
+                        rides[rideIndex.ToUnderlying()] = true;
+                    }
+                }
+            }
+        }
+        return rides;
+    }
+
+    static MapRange GetSearchRange(int32_t tileX, int32_t tileY)
+    {
+        constexpr auto radius = 10 * COORDS_XY_STEP;
+        const auto centre = TileCoordsXY{ tileX, tileY }.ToCoordsXY();
+        return { centre.x - radius, centre.y - radius, centre.x + radius, centre.y + radius };
+    }
+
+    static void ExpectSameAsScan(int32_t step)
+    {
+        const auto mapSize = static_cast<int32_t>(gMapSize.x);
+        for (int32_t x = -12; x < mapSize + 12; x += step)
+        {
+            for (int32_t y = -12; y < mapSize + 12; y += step)
+            {
+                const auto range = GetSearchRange(x, y);
+                ASSERT_EQ(RidePresenceGetRidesInRange(range).data(), ScanRidesInRange(range).data())
+                    << "at " << x << ", " << y;
+            }
+        }
+    }
+
+    static std::shared_ptr<IContext> _context;
+};
+
+std::shared_ptr<IContext> RidePresenceTest::_context;
+
+TEST_F(RidePresenceTest, matches_tile_scan)
+{
+    ExpectSameAsScan(1);
+}
+
+TEST_F(RidePresenceTest, matches_tile_scan_after_track_changes)
+{
+    // Remove all track from a tile in the middle of a block, then add track for another ride next to it.
+    CoordsXY removed{ COORDS_NULL, 0 };
+    const auto mapSize = static_cast<int32_t>(gMapSize.x);
+    for (int32_t x = 3; x < mapSize && removed.IsNull(); x += RidePresenceBlockSize)
+    {
+        for (int32_t y = 4; y < mapSize && removed.IsNull(); y += RidePresenceBlockSize)
+        {
+            const auto location = TileCoordsXY{ x, y }.ToCoordsXY();
+            for (;;)
+            {
+                TrackElement* trackElement = nullptr;
+                for (auto* element : TileElementsView<TrackElement>(location))
+                {
+                    trackElement = element;
+                    break;
+                }
+                if (trackElement == nullptr)
+                    break;
+
+                tile_element_remove(trackElement->as<TileElement>());
+                removed = location;
+            }
+        }
+    }
+    ASSERT_FALSE(removed.IsNull());
+    ExpectSameAsScan(3);
+
+    const auto added = CoordsXY{ removed.x + 4 * COORDS_XY_STEP, removed.y };
+    auto* trackElement = TileElementInsert<TrackElement>({ added, 0 }, 0b1111);
+    ASSERT_NE(trackElement, nullptr);
+    trackElement->SetRideIndex(RideId::FromUnderlying(OpenRCT2::Limits::MaxRidesInPark - 1));
+    const auto range = GetSearchRange(added.x / COORDS_XY_STEP, added.y / COORDS_XY_STEP);
+    ASSERT_TRUE(RidePresenceGetRidesInRange(range)[OpenRCT2::Limits::MaxRidesInPark - 1]);
+    ExpectSameAsScan(3);
+}
+
+TEST_F(RidePresenceTest, guest_ride_selection)
+{
+    int32_t numGuests = 0;
+    for (auto* guest : EntityList<Guest>())
+    {
+        if (guest->x == LOCATION_NULL || guest->HasItem(ShopItem::Map))
+            continue;
+
+        auto expected = ScanRidesInRange(GetSearchRange(guest->x / COORDS_XY_STEP, guest->y / COORDS_XY_STEP));
+        for (auto& ride : GetRideManager())
+        {
+            if (ride.highest_drop_height > 66 || ride.excitement >= RIDE_RATING(8, 00))
+            {
+                expected[ride.id.ToUnderlying()] = true;
+            }
+        }
+        ASSERT_EQ(guest->FindRidesToGoOn().data(), expected.data());
+        numGuests++;
+    }
+    ASSERT_GT(numGuests, 0);
+}
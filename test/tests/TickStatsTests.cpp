@@ -0,0 +1,97 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2022 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <openrct2/profiling/TickStats.h>
+#include <sstream>
+#include <string>
+
+using namespace OpenRCT2;
+using namespace std::chrono_literals;
+
+static void RecordPeepTick(std::chrono::nanoseconds peepTime)
+{
+    TickStats::TickTimes partTimes{};
+    partTimes[static_cast<size_t>(LogicTimePart::Peep)] = peepTime;
+    TickStats::RecordTick(partTimes, peepTime * 2);
+}
+
+static const TickStats::PartStats& GetPart(const TickStats::Summary& summary, std::string_view name)
+{
+    auto it = std::find_if(summary.Parts.begin(), summary.Parts.end(), [name](const auto& part) {
+        return part.Name == name;
+    });
+    EXPECT_NE(it, summary.Parts.end());
+    return *it;
+}
+
+TEST(TickStatsTest, percentiles)
+{
+    TickStats::Reset();
+    for (int32_t i = 1; i <= 100; i++)
+    {
+        RecordPeepTick(i * 1us);
+    }
+
+    auto summary = TickStats::GetSummary();
+    ASSERT_EQ(summary.NumTicks, 100U);
+    ASSERT_EQ(summary.Parts.size(), static_cast<size_t>(LogicTimePart::Count) + 1);
+
+    const auto& peep = GetPart(summary, "Peep");
+    ASSERT_GE(peep.P50, 0.050);
+    ASSERT_LE(peep.P50, 0.050 * 1.125);
+    ASSERT_GE(peep.P95, 0.095);
+    ASSERT_LE(peep.P95, 0.1);
+    ASSERT_GE(peep.P99, 0.099);
+    ASSERT_DOUBLE_EQ(peep.Max, 0.1);
+    ASSERT_DOUBLE_EQ(GetPart(summary, "Total").Max, 0.2);
+    ASSERT_DOUBLE_EQ(GetPart(summary, "Vehicle").Max, 0.0);
+}
+
+TEST(TickStatsTest, window_drops_old_ticks)
+{
+    TickStats::Reset();
+    for (int32_t i = 0; i < 10; i++)
+    {
+        RecordPeepTick(1s);
+    }
+    for (size_t i = 0; i < TickStats::WindowSize; i++)
+    {
+        RecordPeepTick(1us);
+    }
+
+    auto summary = TickStats::GetSummary();
+    ASSERT_EQ(summary.NumTicks, TickStats::WindowSize);
+    const auto& peep = GetPart(summary, "Peep");
+    ASSERT_DOUBLE_EQ(peep.P99, 0.001);
+    ASSERT_DOUBLE_EQ(peep.Max, 0.001);
+
+    TickStats::Reset();
+    summary = TickStats::GetSummary();
+    ASSERT_EQ(summary.NumTicks, 0U);
+    ASSERT_DOUBLE_EQ(GetPart(summary, "Peep").Max, 0.0);
+}
+
+TEST(TickStatsTest, csv_columns_match_header)
+{
+    TickStats::Reset();
+    RecordPeepTick(5us);
+
+    const auto summary = TickStats::GetSummary();
+    std::ostringstream header;
+    std::ostringstream row;
+    TickStats::WriteCsvHeader(header, summary);
+    TickStats::WriteCsvRow(row, summary);
+
+    const auto headerText = header.str();
+    const auto rowText = row.str();
+    ASSERT_EQ(std::count(headerText.begin(), headerText.end(), ','), std::count(rowText.begin(), rowText.end(), ','));
+    ASSERT_NE(headerText.find("PeepP95"), std::string::npos);
+}